@@ -2,7 +2,11 @@
 
 #include "Game/RiveActorComponent.h"
 
+#include "Camera/PlayerCameraManager.h"
+#include "Components/PrimitiveComponent.h"
+#include "Engine/World.h"
 #include "GameFramework/Actor.h"
+#include "GameFramework/PlayerController.h"
 #include "IRiveRenderer.h"
 #include "IRiveRendererModule.h"
 #include "Logs/RiveLog.h"
@@ -14,6 +18,108 @@
 
 class FRiveStateMachine;
 
+static TAutoConsoleVariable<float> CVarRiveResolutionScale(
+    TEXT("r.rive.resolutionscale"),
+    1.f,
+    TEXT("Scales the render resolution picked for Rive components using "
+         "bAutoResolution. Meant to be set per scalability level, e.g. in the "
+         "[TextureQuality@N] sections of Scalability.ini."),
+    ECVF_Scalability);
+
+namespace UE::Private::RiveActorComponent
+{
+// Materials can change at runtime, so we look for the primitive showing our
+// texture again every so often
+constexpr double DisplayPrimitiveSearchInterval = 1.0;
+
+/**
+ * Time since the actor was last rendered and its distance to the closest view
+ * of the last frame, both 0 when unknown
+ */
+void GetRenderState(const AActor* InActor,
+                    float& OutSecondsSinceRendered,
+                    float& OutDistance)
+{
+    OutSecondsSinceRendered = 0.f;
+    OutDistance = 0.f;
+
+    const UWorld* World = InActor ? InActor->GetWorld() : nullptr;
+    if (World == nullptr)
+    {
+        return;
+    }
+
+    // Actors that never rendered, e.g. without any primitive, may still
+    // feed their texture to something else on screen
+    const float LastRenderTime = InActor->GetLastRenderTime();
+    if (LastRenderTime > 0.f)
+    {
+        OutSecondsSinceRendered =
+            FMath::Max(World->GetTimeSeconds() - LastRenderTime, 0.f);
+    }
+
+    if (!World->ViewLocationsRenderedLastFrame.IsEmpty())
+    {
+        const FVector Location = InActor->GetActorLocation();
+        double MinDistanceSquared = TNumericLimits<double>::Max();
+        for (const FVector& ViewLocation :
+             World->ViewLocationsRenderedLastFrame)
+        {
+            MinDistanceSquared =
+                FMath::Min(MinDistanceSquared,
+                           FVector::DistSquared(Location, ViewLocation));
+        }
+        OutDistance = FMath::Sqrt(MinDistanceSquared);
+    }
+}
+
+/** First visible primitive of the actor with a material sampling the texture */
+UPrimitiveComponent* FindDisplayPrimitive(const AActor* InActor,
+                                          const UTexture* InTexture)
+{
+    TInlineComponentArray<UPrimitiveComponent*> Primitives(InActor);
+    TArray<UTexture*> Textures;
+    for (UPrimitiveComponent* Primitive : Primitives)
+    {
+        if (!Primitive->IsRegistered() || !Primitive->IsVisible())
+        {
+            continue;
+        }
+
+        Textures.Reset();
+        Primitive->GetUsedTextures(Textures, EMaterialQualityLevel::Num);
+        if (Textures.Contains(InTexture))
+        {
+            return Primitive;
+        }
+    }
+    return nullptr;
+}
+
+/**
+ * Power of two resolution for the desired one, staying on the current one
+ * until the desired resolution is past it by more than the hysteresis
+ */
+int32 PickResolutionBucket(int32 InCurrent, float InDesired, float InHysteresis)
+{
+    const int32 Bucket = static_cast<int32>(FMath::RoundUpToPowerOfTwo(
+        static_cast<uint32>(FMath::Max(FMath::CeilToInt(InDesired), 1))));
+    if (InCurrent > 0)
+    {
+        if (Bucket > InCurrent && InDesired <= InCurrent * (1.f + InHysteresis))
+        {
+            return InCurrent;
+        }
+        if (Bucket < InCurrent &&
+            InDesired >= InCurrent * 0.5f * (1.f - InHysteresis))
+        {
+            return InCurrent;
+        }
+    }
+    return Bucket;
+}
+} // namespace UE::Private::RiveActorComponent
+
 constexpr rive::ColorInt Cyan = 0xFF00FFFF;
 constexpr rive::ColorInt Magenta = 0xFFFF00FF;
 constexpr rive::ColorInt Yellow = 0xFFFFFF00;
@@ -149,17 +255,62 @@ void URiveActorComponent::TickComponent(
                                 STAT_RIVEACTORCOMPONENT_TICK,
                                 STATGROUP_Rive);
 
+    if (!RiveRenderTarget)
+    {
+        return;
+    }
+
+    float SecondsSinceRendered = 0.f;
+    float ViewDistance = 0.f;
+    UE::Private::RiveActorComponent::GetRenderState(GetOwner(),
+                                                    SecondsSinceRendered,
+                                                    ViewDistance);
+
+    UpdateAutoResolution();
+
+    float TickDeltaSeconds = 0.f;
+    if (!UpdateRatePolicy.ShouldTick(UpdateRateState,
+                                     DeltaTime,
+                                     SecondsSinceRendered,
+                                     ViewDistance,
+                                     TickDeltaSeconds))
+    {
+        return;
+    }
+
+    if (URiveTickSubsystem* TickSubsystem = URiveTickSubsystem::Get())
+    {
+        TickSubsystem->QueueTick(this, this, TickDeltaSeconds);
+        return;
+    }
+
+    URiveArtboard::AdvanceStateMachines(Artboards, TickDeltaSeconds);
+    TickRender(TickDeltaSeconds);
+}
+
+void URiveActorComponent::GatherArtboards(TArray<URiveArtboard*>& OutArtboards)
+{
     if (RiveRenderTarget)
     {
-        for (URiveArtboard* Artboard : Artboards)
-        {
-            RiveRenderTarget->Save();
-            Artboard->Tick(DeltaTime);
-            RiveRenderTarget->Restore();
-        }
+        OutArtboards.Append(Artboards);
+    }
+}
 
-        RiveRenderTarget->SubmitAndClear();
+void URiveActorComponent::TickRender(float InDeltaSeconds)
+{
+    if (!RiveRenderTarget)
+    {
+        return;
+    }
+
+    for (URiveArtboard* Artboard : Artboards)
+    {
+        RiveRenderTarget->Save();
+        Artboard->Tick_Render(InDeltaSeconds);
+        RiveRenderTarget->Restore();
     }
+
+    RiveRenderTarget->SubmitAndClear();
 }
 
 void URiveActorComponent::Initialize()
@@ -231,7 +382,8 @@ void URiveActorComponent::ResizeRenderTarget(int32 InSizeX, int32 InSizeY)
         return;
     }
 
-    RiveTexture->ResizeRenderTargets(FIntPoint(InSizeX, InSizeY));
+    Size = FIntPoint(InSizeX, InSizeY);
+    RiveTexture->ResizeRenderTargets(GetRenderTargetSize());
 }
 
 URiveArtboard* URiveActorComponent::AddArtboard(
@@ -287,11 +439,21 @@ URiveArtboard* URiveActorComponent::AddArtboard(
         return nullptr;
     }
 
-    URiveArtboard* Artboard = NewObject<URiveArtboard>();
-    Artboard->Initialize(InRiveFile,
-                         RiveRenderTarget,
-                         InArtboardName,
-                         InStateMachineName);
+    // Artboards prewarmed during loading are already instanced and drawn once
+    URiveArtboard* Artboard =
+        InRiveFile->TakePrewarmedArtboard(InArtboardName, InStateMachineName);
+    if (Artboard)
+    {
+        Artboard->SetRenderTarget(RiveRenderTarget);
+    }
+    else
+    {
+        Artboard = NewObject<URiveArtboard>();
+        Artboard->Initialize(InRiveFile,
+                             RiveRenderTarget,
+                             InArtboardName,
+                             InStateMachineName);
+    }
     Artboards.Add(Artboard);
 
     if (RiveAudioEngine != nullptr)
@@ -397,22 +559,167 @@ void URiveActorComponent::OnResourceInitialized_RenderThread(
 void URiveActorComponent::OnDefaultArtboardTickRender(float DeltaTime,
                                                       URiveArtboard* InArtboard)
 {
+    if (bAutoResolution && RiveTexture && Size.X > 0 && Size.Y > 0)
+    {
+        // Laid out in Size whatever resolution we render at, then scaled to
+        // the render target. TickRender restores the transform after us.
+        const FVector2f Scale = FVector2f(RiveTexture->Size) / FVector2f(Size);
+        RiveRenderTarget->Transform(Scale.X, 0.f, 0.f, Scale.Y, 0.f, 0.f);
+        InArtboard->Align(FBox2f(FVector2f::ZeroVector, FVector2f(Size)),
+                          DefaultRiveDescriptor.FitType,
+                          DefaultRiveDescriptor.Alignment,
+                          DefaultRiveDescriptor.ScaleFactor);
+        InArtboard->Draw();
+        return;
+    }
+
     InArtboard->Align(DefaultRiveDescriptor.FitType,
                       DefaultRiveDescriptor.Alignment,
                       DefaultRiveDescriptor.ScaleFactor);
     InArtboard->Draw();
 }
 
+FIntPoint URiveActorComponent::GetRenderTargetSize() const
+{
+    if (!bAutoResolution || AutoResolution <= 0 || Size.X <= 0 || Size.Y <= 0)
+    {
+        return Size;
+    }
+
+    // Keep the aspect ratio of Size
+    const float Scale =
+        static_cast<float>(AutoResolution) / FMath::Max(Size.X, Size.Y);
+    return FIntPoint(FMath::Clamp(FMath::RoundToInt(Size.X * Scale),
+                                  RIVE_MIN_TEX_RESOLUTION,
+                                  RIVE_MAX_TEX_RESOLUTION),
+                     FMath::Clamp(FMath::RoundToInt(Size.Y * Scale),
+                                  RIVE_MIN_TEX_RESOLUTION,
+                                  RIVE_MAX_TEX_RESOLUTION));
+}
+
+void URiveActorComponent::UpdateAutoResolution()
+{
+    using namespace UE::Private::RiveActorComponent;
+
+    if (!RiveTexture)
+    {
+        return;
+    }
+
+    if (!bAutoResolution)
+    {
+        // Turned off at runtime, go back to Size
+        if (AutoResolution != 0)
+        {
+            AutoResolution = 0;
+            RiveTexture->ResizeRenderTargets(Size);
+        }
+        return;
+    }
+
+    // Without a view to measure from, keep whatever we have
+    const float ScreenSize = GetProjectedScreenSize();
+    if (ScreenSize <= 0.f)
+    {
+        return;
+    }
+
+    const float DesiredResolution =
+        ScreenSize * AutoResolutionUVScale *
+        FMath::Max(CVarRiveResolutionScale.GetValueOnGameThread(), 0.f);
+
+    const int32 MaxResolution = FMath::Clamp(MaxAutoResolution,
+                                             RIVE_MIN_TEX_RESOLUTION,
+                                             RIVE_MAX_TEX_RESOLUTION);
+    const int32 MinResolution =
+        FMath::Clamp(MinAutoResolution, RIVE_MIN_TEX_RESOLUTION, MaxResolution);
+    const int32 NewResolution =
+        FMath::Clamp(PickResolutionBucket(AutoResolution,
+                                          DesiredResolution,
+                                          AutoResolutionHysteresis),
+                     MinResolution,
+                     MaxResolution);
+    if (NewResolution == AutoResolution)
+    {
+        return;
+    }
+
+    AutoResolution = NewResolution;
+    INC_DWORD_STAT(STAT_RiveAutoResolutionChanges);
+    RiveTexture->ResizeRenderTargets(GetRenderTargetSize());
+}
+
+float URiveActorComponent::GetProjectedScreenSize()
+{
+    using namespace UE::Private::RiveActorComponent;
+
+    const AActor* Owner = GetOwner();
+    const UWorld* World = GetWorld();
+    if (Owner == nullptr || World == nullptr)
+    {
+        return 0.f;
+    }
+
+    const APlayerController* PlayerController =
+        World->GetFirstPlayerController();
+    if (PlayerController == nullptr ||
+        PlayerController->PlayerCameraManager == nullptr)
+    {
+        return 0.f;
+    }
+
+    int32 ViewportSizeX = 0;
+    int32 ViewportSizeY = 0;
+    PlayerController->GetViewportSize(ViewportSizeX, ViewportSizeY);
+    if (ViewportSizeX <= 0)
+    {
+        return 0.f;
+    }
+
+    const double Now = World->GetTimeSeconds();
+    if (Now >= NextDisplayPrimitiveSearchTime)
+    {
+        DisplayPrimitive = FindDisplayPrimitive(Owner, RiveTexture);
+        NextDisplayPrimitiveSearchTime = Now + DisplayPrimitiveSearchInterval;
+    }
+
+    // Without a primitive sampling our texture, e.g. when it goes through a
+    // render target of its own, the whole actor is our best guess
+    FBoxSphereBounds Bounds;
+    if (const UPrimitiveComponent* Primitive = DisplayPrimitive.Get())
+    {
+        Bounds = Primitive->Bounds;
+    }
+    else
+    {
+        const FBox Box = Owner->GetComponentsBoundingBox(true);
+        if (!Box.IsValid)
+        {
+            return 0.f;
+        }
+        Bounds = FBoxSphereBounds(Box);
+    }
+
+    const APlayerCameraManager* Camera = PlayerController->PlayerCameraManager;
+    const float HalfFOV = FMath::DegreesToRadians(
+                              FMath::Clamp(Camera->GetFOVAngle(), 1.f, 170.f)) *
+                          0.5f;
+    const float Distance =
+        FMath::Max(FVector::Dist(Bounds.Origin, Camera->GetCameraLocation()),
+                   FMath::Max(Bounds.SphereRadius, UE_KINDA_SMALL_NUMBER));
+
+    // Longest side of the bounds facing the camera, over the horizontal field
+    // of view
+    const float HalfLength = Bounds.BoxExtent.GetMax();
+    return ViewportSizeX * HalfLength / (Distance * FMath::Tan(HalfFOV));
+}
+
 TArray<FString> URiveActorComponent::GetArtboardNamesForDropdown() const
 {
     TArray<FString> Output;
     if (DefaultRiveDescriptor.RiveFile)
     {
-        for (URiveArtboard* Artboard :
-             DefaultRiveDescriptor.RiveFile->Artboards)
-        {
-            Output.Add(Artboard->GetArtboardName());
-        }
+        Output = DefaultRiveDescriptor.RiveFile->GetArtboardNamesForDropdown();
     }
     return Output;
 }
@@ -422,15 +729,11 @@ TArray<FString> URiveActorComponent::GetStateMachineNamesForDropdown() const
     TArray<FString> Output{""};
     if (DefaultRiveDescriptor.RiveFile)
     {
-        for (URiveArtboard* Artboard :
-             DefaultRiveDescriptor.RiveFile->Artboards)
-        {
-            if (Artboard->GetArtboardName().Equals(
+        if (const FRiveArtboardInfo* ArtboardInfo =
+                DefaultRiveDescriptor.RiveFile->FindArtboardInfo(
                     DefaultRiveDescriptor.ArtboardName))
-            {
-                Output.Append(Artboard->GetStateMachineNames());
-                break;
-            }
+        {
+            Output.Append(ArtboardInfo->GetStateMachineNames());
         }
     }
     return Output;
@@ -486,7 +789,7 @@ void URiveActorComponent::RiveReady(IRiveRenderer* InRiveRenderer)
     RiveRenderTarget =
         InRiveRenderer->CreateTextureTarget_GameThread(GetFName(), RiveTexture);
     RiveRenderTarget->SetClearColor(FLinearColor::White);
-    RiveTexture->ResizeRenderTargets(FIntPoint(Size.X, Size.Y));
+    RiveTexture->ResizeRenderTargets(GetRenderTargetSize());
     RiveRenderTarget->Initialize();
 
     RiveTexture->OnResourceInitializedOnRenderThread.AddUObject(
@@ -499,7 +802,7 @@ void URiveActorComponent::RiveReady(IRiveRenderer* InRiveRenderer)
             AddArtboard(DefaultRiveDescriptor.RiveFile,
                         DefaultRiveDescriptor.ArtboardName,
                         DefaultRiveDescriptor.StateMachineName);
-        Artboard->OnArtboardTick_Render.BindDynamic(
+        Artboard->OnArtboardTick_RenderNative.BindUObject(
             this,
             &URiveActorComponent::OnDefaultArtboardTickRender);
     }
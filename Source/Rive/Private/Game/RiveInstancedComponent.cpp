@@ -0,0 +1,513 @@
+// Copyright Rive, Inc. All rights reserved.
+
+#include "Game/RiveInstancedComponent.h"
+
+#include "Components/InstancedStaticMeshComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "IRiveRenderer.h"
+#include "IRiveRendererModule.h"
+#include "Logs/RiveLog.h"
+#include "Materials/MaterialInstanceDynamic.h"
+#include "Rive/RiveArtboard.h"
+#include "Rive/RiveFile.h"
+#include "Rive/RiveStateMachine.h"
+#include "Rive/RiveTexture.h"
+#include "Stats/RiveStats.h"
+
+static TAutoConsoleVariable<int32> CVarRiveInstancedDedup(
+    TEXT("r.rive.instanced.dedup"),
+    1,
+    TEXT("If non 0, settled instances of a Rive instanced component whose "
+         "inputs hold the same values are drawn once and share a tile. "
+         "State machines with triggers or listeners are never shared."),
+    ECVF_Default);
+
+URiveInstancedComponent::URiveInstancedComponent()
+{
+    PrimaryComponentTick.bCanEverTick = true;
+}
+
+void URiveInstancedComponent::BeginPlay()
+{
+    Initialize();
+    Super::BeginPlay();
+}
+
+void URiveInstancedComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    DEC_DWORD_STAT_BY(STAT_RiveInstancedArtboards, GetInstanceCount());
+    ArtboardPool.Reset();
+    Instances.Empty();
+    DisplayTiles.Empty();
+    MeshInstanceIndices.Empty();
+    RiveRenderTarget.Reset();
+
+    Super::EndPlay(EndPlayReason);
+}
+
+void URiveInstancedComponent::TickComponent(
+    float DeltaTime,
+    ELevelTick TickType,
+    FActorComponentTickFunction* ThisTickFunction)
+{
+    Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+    if (!RiveRenderTarget || GetInstanceCount() == 0)
+    {
+        return;
+    }
+
+    SCOPED_NAMED_EVENT_TEXT(TEXT("URiveInstancedComponent::TickComponent"),
+                            FColor::White);
+    DECLARE_SCOPE_CYCLE_COUNTER(TEXT("URiveInstancedComponent::TickComponent"),
+                                STAT_RIVEINSTANCEDCOMPONENT_TICK,
+                                STATGROUP_Rive);
+
+    // Instances are spread over the mesh, only whether it renders at all
+    // tells us anything
+    float SecondsSinceRendered = 0.f;
+    const UInstancedStaticMeshComponent* MeshComponent = GetMesh();
+    const UWorld* World = GetWorld();
+    if (MeshComponent && World && MeshComponent->GetLastRenderTime() > 0.f)
+    {
+        SecondsSinceRendered =
+            FMath::Max(World->GetTimeSeconds() -
+                           MeshComponent->GetLastRenderTime(),
+                       0.f);
+    }
+
+    float TickDeltaSeconds = 0.f;
+    if (!UpdateRatePolicy.ShouldTick(UpdateRateState,
+                                     DeltaTime,
+                                     SecondsSinceRendered,
+                                     0.f,
+                                     TickDeltaSeconds))
+    {
+        return;
+    }
+
+    if (URiveTickSubsystem* TickSubsystem = URiveTickSubsystem::Get())
+    {
+        TickSubsystem->QueueTick(this, this, TickDeltaSeconds);
+        return;
+    }
+
+    TickRender(TickDeltaSeconds);
+}
+
+void URiveInstancedComponent::GatherArtboards(
+    TArray<URiveArtboard*>& OutArtboards)
+{
+    // Our instances aren't URiveArtboards, TickRender advances them
+}
+
+void URiveInstancedComponent::TickRender(float InDeltaSeconds)
+{
+    SCOPED_NAMED_EVENT_TEXT("URiveInstancedComponent::TickRender",
+                            FColor::White);
+    DECLARE_SCOPE_CYCLE_COUNTER(TEXT("RiveInstancedComponent::TickRender"),
+                                STAT_RIVEINSTANCEDCOMPONENT_TICKRENDER,
+                                STATGROUP_Rive);
+
+    if (!RiveRenderTarget || !ArtboardPool)
+    {
+        return;
+    }
+
+    ArtboardPool->AdvanceAll(InDeltaSeconds);
+
+    const int32 InstanceCount = GetInstanceCount();
+    const int32 SharedCount = UpdateDisplayTiles();
+    INC_DWORD_STAT_BY(STAT_RiveInstancedSharedDraws, SharedCount);
+    SET_FLOAT_STAT(STAT_RiveInstancedDedupRatio,
+                   InstanceCount > 0 ? 100.f * SharedCount / InstanceCount
+                                     : 0.f);
+
+    // Every instance records its draw commands into the shared render
+    // target, then the whole atlas goes out in a single submit
+    for (int32 Tile = 0; Tile < Instances.Num(); ++Tile)
+    {
+        if (!ArtboardPool->IsValid(Instances[Tile]) ||
+            DisplayTiles[Tile] != Tile)
+        {
+            continue;
+        }
+
+        const FIntRect TileRect = GetTileRect(Tile);
+        const FBox2f TileBox(FVector2f(TileRect.Min), FVector2f(TileRect.Max));
+        RiveRenderTarget->Save();
+        // Artboards overflowing their fit would bleed into their neighbours
+        RiveRenderTarget->ClipRect(TileBox);
+        ArtboardPool->Draw(
+            Instances[Tile],
+            *RiveRenderTarget,
+            TileBox,
+            RiveDescriptor.FitType,
+            RiveDescriptor.Alignment,
+            RiveDescriptor.ScaleFactor);
+        RiveRenderTarget->Restore();
+    }
+
+    RiveRenderTarget->SubmitAndClear();
+}
+
+void URiveInstancedComponent::Initialize()
+{
+    IRiveRenderer* RiveRenderer = IRiveRendererModule::Get().GetRenderer();
+    if (!RiveRenderer)
+    {
+        UE_LOG(LogRive,
+               Error,
+               TEXT("RiveRenderer is null, unable to initialize the "
+                    "RenderTarget for Rive file '%s'"),
+               *GetFullNameSafe(this));
+        return;
+    }
+
+    RiveRenderer->CallOrRegister_OnInitialized(
+        IRiveRenderer::FOnRendererInitialized::FDelegate::CreateUObject(
+            this,
+            &URiveInstancedComponent::RiveReady));
+}
+
+int32 URiveInstancedComponent::AddInstance(int32 InMeshInstanceIndex)
+{
+    if (!RiveRenderTarget)
+    {
+        UE_LOG(LogRive,
+               Error,
+               TEXT("Can't add a Rive instance to '%s' before it is ready."),
+               *GetFullNameSafe(this));
+        return INDEX_NONE;
+    }
+
+    URiveFile* RiveFile = RiveDescriptor.RiveFile;
+    if (!IsValid(RiveFile) || !RiveFile->IsInitialized())
+    {
+        UE_LOG(LogRive,
+               Error,
+               TEXT("Can't instantiate an artboard without a valid and "
+                    "initialized RiveFile."));
+        return INDEX_NONE;
+    }
+
+    // Instances can't outlive the file they come from
+    if (ArtboardPool && ArtboardPool->GetFile() != RiveFile)
+    {
+        for (FRiveArtboardHandle& Instance : Instances)
+        {
+            Instance = {};
+        }
+        for (int32 Tile = 0; Tile < DisplayTiles.Num(); ++Tile)
+        {
+            DisplayTiles[Tile] = Tile;
+        }
+        DEC_DWORD_STAT_BY(STAT_RiveInstancedArtboards, GetInstanceCount());
+        ArtboardPool.Reset();
+    }
+    if (!ArtboardPool)
+    {
+        ArtboardPool = MakeUnique<FRiveArtboardPool>(RiveFile);
+    }
+
+    const int32 Tile = Instances.IndexOfByPredicate(
+        [this](const FRiveArtboardHandle& Instance) {
+            return !ArtboardPool->IsValid(Instance);
+        });
+    if (Tile == INDEX_NONE)
+    {
+        UE_LOG(LogRive,
+               Warning,
+               TEXT("All %d tiles of '%s' are in use, raise MaxInstances or "
+                    "lower TileSize."),
+               Instances.Num(),
+               *GetFullNameSafe(this));
+        return INDEX_NONE;
+    }
+
+    const FRiveArtboardHandle Instance =
+        ArtboardPool->Create(RiveDescriptor.ArtboardName,
+                             RiveDescriptor.StateMachineName);
+    if (!Instance.IsSet())
+    {
+        return INDEX_NONE;
+    }
+
+    Instances[Tile] = Instance;
+    DisplayTiles[Tile] = Tile;
+    INC_DWORD_STAT(STAT_RiveInstancedArtboards);
+
+    if (InMeshInstanceIndex >= 0)
+    {
+        SetMeshInstanceTile(InMeshInstanceIndex, Tile);
+    }
+
+    return Tile;
+}
+
+void URiveInstancedComponent::RemoveInstance(int32 InTile)
+{
+    if (!ArtboardPool || !Instances.IsValidIndex(InTile) ||
+        !ArtboardPool->IsValid(Instances[InTile]))
+    {
+        return;
+    }
+
+    ArtboardPool->Release(Instances[InTile]);
+    Instances[InTile] = {};
+    DisplayTiles[InTile] = InTile;
+    MeshInstanceIndices[InTile] = INDEX_NONE;
+    DEC_DWORD_STAT(STAT_RiveInstancedArtboards);
+}
+
+FRiveStateMachine* URiveInstancedComponent::GetInstanceStateMachine(
+    int32 InTile) const
+{
+    return ArtboardPool && Instances.IsValidIndex(InTile)
+               ? ArtboardPool->GetStateMachine(Instances[InTile])
+               : nullptr;
+}
+
+void URiveInstancedComponent::SetInstanceBoolValue(
+    int32 InTile,
+    const FString& InPropertyName,
+    bool bNewValue)
+{
+    if (FRiveStateMachine* StateMachine = GetInstanceStateMachine(InTile))
+    {
+        StateMachine->SetBoolValue(InPropertyName, bNewValue);
+    }
+}
+
+void URiveInstancedComponent::SetInstanceNumberValue(
+    int32 InTile,
+    const FString& InPropertyName,
+    float NewValue)
+{
+    if (FRiveStateMachine* StateMachine = GetInstanceStateMachine(InTile))
+    {
+        StateMachine->SetNumberValue(InPropertyName, NewValue);
+    }
+}
+
+void URiveInstancedComponent::FireInstanceTrigger(
+    int32 InTile,
+    const FString& InPropertyName)
+{
+    if (const FRiveStateMachine* StateMachine =
+            GetInstanceStateMachine(InTile))
+    {
+        StateMachine->FireTrigger(InPropertyName);
+    }
+}
+
+void URiveInstancedComponent::SetMeshInstanceTile(int32 InMeshInstanceIndex,
+                                                  int32 InTile)
+{
+    if (!MeshInstanceIndices.IsValidIndex(InTile))
+    {
+        return;
+    }
+
+    MeshInstanceIndices[InTile] = InMeshInstanceIndex;
+    WriteMeshInstanceTile(InMeshInstanceIndex, DisplayTiles[InTile]);
+}
+
+void URiveInstancedComponent::WriteMeshInstanceTile(int32 InMeshInstanceIndex,
+                                                    int32 InTile)
+{
+    UInstancedStaticMeshComponent* MeshComponent = GetMesh();
+    if (MeshComponent == nullptr)
+    {
+        return;
+    }
+
+    if (MeshComponent->NumCustomDataFloats <= TileCustomDataIndex)
+    {
+        UE_LOG(LogRive,
+               Warning,
+               TEXT("'%s' needs at least %d per instance custom data floats "
+                    "to receive Rive tiles."),
+               *GetFullNameSafe(MeshComponent),
+               TileCustomDataIndex + 1);
+        return;
+    }
+
+    MeshComponent->SetCustomDataValue(InMeshInstanceIndex,
+                                      TileCustomDataIndex,
+                                      static_cast<float>(InTile),
+                                      true);
+}
+
+FBox2f URiveInstancedComponent::GetTileUVRegion(int32 InTile) const
+{
+    const FIntRect TileRect = GetTileRect(
+        DisplayTiles.IsValidIndex(InTile) ? DisplayTiles[InTile] : InTile);
+    const FVector2f AtlasSize(Columns * TileSize.X, Rows * TileSize.Y);
+    return FBox2f(FVector2f(TileRect.Min) / AtlasSize,
+                  FVector2f(TileRect.Max) / AtlasSize);
+}
+
+void URiveInstancedComponent::RiveReady(IRiveRenderer* InRiveRenderer)
+{
+    // Tiles fill rows of a texture as square as possible, within the largest
+    // Rive texture
+    const FIntPoint ClampedTileSize(FMath::Clamp(TileSize.X,
+                                                 RIVE_MIN_TEX_RESOLUTION,
+                                                 RIVE_MAX_TEX_RESOLUTION),
+                                    FMath::Clamp(TileSize.Y,
+                                                 RIVE_MIN_TEX_RESOLUTION,
+                                                 RIVE_MAX_TEX_RESOLUTION));
+    const int32 MaxColumns = RIVE_MAX_TEX_RESOLUTION / ClampedTileSize.X;
+    const int32 MaxRows = RIVE_MAX_TEX_RESOLUTION / ClampedTileSize.Y;
+    const int32 Capacity =
+        FMath::Clamp(MaxInstances, 1, MaxColumns * MaxRows);
+    if (Capacity < MaxInstances)
+    {
+        UE_LOG(LogRive,
+               Warning,
+               TEXT("'%s' only fits %d tiles of %dx%d, instead of %d."),
+               *GetFullNameSafe(this),
+               Capacity,
+               ClampedTileSize.X,
+               ClampedTileSize.Y,
+               MaxInstances);
+    }
+
+    TileSize = ClampedTileSize;
+    Columns = FMath::Clamp(
+        FMath::CeilToInt(FMath::Sqrt(static_cast<float>(Capacity) *
+                                     TileSize.Y / TileSize.X)),
+        1,
+        MaxColumns);
+    Rows = FMath::Min(FMath::DivideAndRoundUp(Capacity, Columns), MaxRows);
+    const int32 TileCount = FMath::Min(Capacity, Columns * Rows);
+    Instances.SetNum(TileCount);
+    MeshInstanceIndices.Init(INDEX_NONE, TileCount);
+    DisplayTiles.SetNumUninitialized(TileCount);
+    for (int32 Tile = 0; Tile < TileCount; ++Tile)
+    {
+        DisplayTiles[Tile] = Tile;
+    }
+
+    RiveTexture = NewObject<URiveTexture>(this);
+    RiveRenderTarget =
+        InRiveRenderer->CreateTextureTarget_GameThread(GetFName(), RiveTexture);
+    RiveRenderTarget->SetClearColor(FLinearColor::Transparent);
+    RiveTexture->ResizeRenderTargets(
+        FIntPoint(Columns * TileSize.X, Rows * TileSize.Y));
+    RiveRenderTarget->Initialize();
+
+    RiveTexture->OnResourceInitializedOnRenderThread.AddUObject(
+        this,
+        &URiveInstancedComponent::OnResourceInitialized_RenderThread);
+
+    BindToMesh();
+
+    OnRiveReady.Broadcast();
+}
+
+void URiveInstancedComponent::OnResourceInitialized_RenderThread(
+    FRHICommandListImmediate& RHICmdList,
+    FTextureRHIRef& NewResource)
+{
+    if (const TSharedPtr<IRiveRenderTarget> RenderTarget = RiveRenderTarget)
+    {
+        RenderTarget->CacheTextureTarget_RenderThread(RHICmdList, NewResource);
+    }
+}
+
+UInstancedStaticMeshComponent* URiveInstancedComponent::GetMesh() const
+{
+    AActor* Owner = GetOwner();
+    if (Owner == nullptr)
+    {
+        return nullptr;
+    }
+
+    if (UInstancedStaticMeshComponent* MeshComponent =
+            Cast<UInstancedStaticMeshComponent>(Mesh.GetComponent(Owner)))
+    {
+        return MeshComponent;
+    }
+    return Owner->FindComponentByClass<UInstancedStaticMeshComponent>();
+}
+
+void URiveInstancedComponent::BindToMesh()
+{
+    UInstancedStaticMeshComponent* MeshComponent = GetMesh();
+    if (MeshComponent == nullptr ||
+        MaterialIndex >= MeshComponent->GetNumMaterials())
+    {
+        return;
+    }
+
+    // Reuses the slot's dynamic instance if it already is one
+    MaterialInstance =
+        MeshComponent->CreateDynamicMaterialInstance(MaterialIndex);
+    if (MaterialInstance != nullptr)
+    {
+        MaterialInstance->SetTextureParameterValue(TextureParameterName,
+                                                   RiveTexture);
+        MaterialInstance->SetScalarParameterValue(ColumnsParameterName,
+                                                  Columns);
+        MaterialInstance->SetScalarParameterValue(RowsParameterName, Rows);
+    }
+}
+
+FIntRect URiveInstancedComponent::GetTileRect(int32 InTile) const
+{
+    const FIntPoint Min((InTile % Columns) * TileSize.X,
+                        (InTile / Columns) * TileSize.Y);
+    return FIntRect(Min, Min + TileSize);
+}
+
+int32 URiveInstancedComponent::UpdateDisplayTiles()
+{
+    const bool bDedup = CVarRiveInstancedDedup.GetValueOnGameThread() != 0;
+
+    // Tiles of the settled instances drawn so far, by input values. Settled
+    // instances have no animation left, so the same state machine with the
+    // same inputs gives the same picture whatever their elapsed time. That
+    // only holds when nothing but those inputs moves the state machine.
+    TMap<TArray<float>, int32> SettledTiles;
+    TArray<float> InputValues;
+
+    int32 SharedCount = 0;
+    for (int32 Tile = 0; Tile < Instances.Num(); ++Tile)
+    {
+        const FRiveArtboardHandle& Instance = Instances[Tile];
+        if (!ArtboardPool->IsValid(Instance))
+        {
+            continue;
+        }
+
+        int32 DisplayTile = Tile;
+        const FRiveStateMachine* StateMachine =
+            ArtboardPool->GetStateMachine(Instance);
+        if (bDedup && StateMachine && ArtboardPool->IsSettled(Instance) &&
+            StateMachine->IsStateDecidedByInputValues())
+        {
+            InputValues.Reset();
+            StateMachine->GetInputValues(InputValues);
+            DisplayTile = SettledTiles.FindOrAdd(InputValues, Tile);
+        }
+
+        if (DisplayTile != Tile)
+        {
+            ++SharedCount;
+        }
+
+        if (DisplayTiles[Tile] != DisplayTile)
+        {
+            DisplayTiles[Tile] = DisplayTile;
+            if (MeshInstanceIndices[Tile] != INDEX_NONE)
+            {
+                WriteMeshInstanceTile(MeshInstanceIndices[Tile], DisplayTile);
+            }
+        }
+    }
+
+    return SharedCount;
+}
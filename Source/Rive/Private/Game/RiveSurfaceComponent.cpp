@@ -0,0 +1,160 @@
+// Copyright Rive, Inc. All rights reserved.
+
+#include "Game/RiveSurfaceComponent.h"
+
+#include "Components/PrimitiveComponent.h"
+#include "GameFramework/Actor.h"
+#include "Kismet/GameplayStatics.h"
+#include "Logs/RiveLog.h"
+#include "Materials/MaterialInstanceDynamic.h"
+#include "Rive/RiveArtboard.h"
+#include "Rive/RiveStateMachine.h"
+#include "Rive/RiveTexture.h"
+
+bool URiveSurfaceComponent::PointerDownAtHit(const FHitResult& InHit)
+{
+    FVector2D UV;
+    return UGameplayStatics::FindCollisionUV(InHit, UVChannel, UV) &&
+           PointerDownAtUV(UV);
+}
+
+bool URiveSurfaceComponent::PointerUpAtHit(const FHitResult& InHit)
+{
+    FVector2D UV;
+    return UGameplayStatics::FindCollisionUV(InHit, UVChannel, UV) &&
+           PointerUpAtUV(UV);
+}
+
+bool URiveSurfaceComponent::PointerMoveAtHit(const FHitResult& InHit)
+{
+    FVector2D UV;
+    return UGameplayStatics::FindCollisionUV(InHit, UVChannel, UV) &&
+           PointerMoveAtUV(UV);
+}
+
+bool URiveSurfaceComponent::PointerDownAtUV(const FVector2D& InUV)
+{
+    return OnInput(InUV,
+                   [](const FVector2f& InputCoordinates,
+                      FRiveStateMachine* InStateMachine) {
+                       return InStateMachine->PointerDown(InputCoordinates);
+                   });
+}
+
+bool URiveSurfaceComponent::PointerUpAtUV(const FVector2D& InUV)
+{
+    return OnInput(InUV,
+                   [](const FVector2f& InputCoordinates,
+                      FRiveStateMachine* InStateMachine) {
+                       return InStateMachine->PointerUp(InputCoordinates);
+                   });
+}
+
+bool URiveSurfaceComponent::PointerMoveAtUV(const FVector2D& InUV)
+{
+    return OnInput(InUV,
+                   [](const FVector2f& InputCoordinates,
+                      FRiveStateMachine* InStateMachine) {
+                       return InStateMachine->PointerMove(InputCoordinates);
+                   });
+}
+
+void URiveSurfaceComponent::PointerExit()
+{
+    URiveArtboard* Artboard = GetDefaultArtboard();
+    if (!IsValid(Artboard))
+    {
+        return;
+    }
+
+    // Outside of the artboard, so nothing in it stays hovered
+    Artboard->BeginInput();
+    Artboard->PointerExit(FVector2f(-1.f, -1.f));
+    Artboard->EndInput();
+}
+
+void URiveSurfaceComponent::BindToMesh()
+{
+    UPrimitiveComponent* MeshComponent = GetMesh();
+    if (MeshComponent == nullptr || RiveTexture == nullptr)
+    {
+        return;
+    }
+
+    if (MaterialIndex >= MeshComponent->GetNumMaterials())
+    {
+        UE_LOG(LogRive,
+               Warning,
+               TEXT("Rive surface '%s' can't bind to material slot %d of '%s' "
+                    "which only has %d."),
+               *GetFullNameSafe(this),
+               MaterialIndex,
+               *GetFullNameSafe(MeshComponent),
+               MeshComponent->GetNumMaterials());
+        return;
+    }
+
+    // Reuses the slot's dynamic instance if it already is one
+    MaterialInstance =
+        MeshComponent->CreateDynamicMaterialInstance(MaterialIndex);
+    if (MaterialInstance != nullptr)
+    {
+        MaterialInstance->SetTextureParameterValue(TextureParameterName,
+                                                   RiveTexture);
+    }
+}
+
+void URiveSurfaceComponent::RiveReady(IRiveRenderer* InRiveRenderer)
+{
+    Super::RiveReady(InRiveRenderer);
+    BindToMesh();
+}
+
+UPrimitiveComponent* URiveSurfaceComponent::GetMesh() const
+{
+    AActor* Owner = GetOwner();
+    if (Owner == nullptr)
+    {
+        return nullptr;
+    }
+
+    if (UPrimitiveComponent* MeshComponent =
+            Cast<UPrimitiveComponent>(Mesh.GetComponent(Owner)))
+    {
+        return MeshComponent;
+    }
+    return Owner->FindComponentByClass<UPrimitiveComponent>();
+}
+
+bool URiveSurfaceComponent::OnInput(
+    const FVector2D& InUV,
+    const TFunction<bool(const FVector2f&, FRiveStateMachine*)>&
+        InStateMachineInputCallback)
+{
+    URiveArtboard* Artboard = GetDefaultArtboard();
+    if (!IsValid(Artboard) || Size.X <= 0 || Size.Y <= 0)
+    {
+        return false;
+    }
+
+    bool bResult = false;
+
+    Artboard->BeginInput();
+    if (FRiveStateMachine* StateMachine = Artboard->GetStateMachine())
+    {
+        // Artboards are laid out in Size whatever our render resolution, UVs
+        // past the edges of a tiled texture wrap around
+        const FVector2f TexturePosition =
+            FVector2f(FMath::Frac(InUV.X), FMath::Frac(InUV.Y)) *
+            FVector2f(Size);
+        const FVector2f InputCoordinates =
+            Artboard->GetLocalCoordinate(TexturePosition,
+                                         Size,
+                                         DefaultRiveDescriptor.Alignment,
+                                         DefaultRiveDescriptor.FitType);
+        bResult = InStateMachineInputCallback(InputCoordinates, StateMachine);
+    }
+    Artboard->EndInput();
+
+    return bResult;
+}
@@ -0,0 +1,145 @@
+// Copyright Rive, Inc. All rights reserved.
+
+#include "Rive/Assets/RiveAssetCache.h"
+
+#include "Hash/xxhash.h"
+#include "Stats/RiveStats.h"
+
+#if WITH_RIVE
+
+THIRD_PARTY_INCLUDES_START
+#include "rive/renderer.hpp"
+#include "rive/text/font.hpp"
+THIRD_PARTY_INCLUDES_END
+
+static TAutoConsoleVariable<int32> CVarRiveAssetCache(
+    TEXT("r.rive.assetcache"),
+    1,
+    TEXT("If non 0, images and fonts embedded in Rive files are decoded once "
+         "for identical bytes and shared between files."),
+    ECVF_Default);
+
+FRiveAssetCache& FRiveAssetCache::Get()
+{
+    static FRiveAssetCache Instance;
+    return Instance;
+}
+
+TOptional<FRiveAssetCache::FKey> FRiveAssetCache::MakeKey(
+    const rive::Span<const uint8>& InBytes)
+{
+    if (CVarRiveAssetCache.GetValueOnAnyThread() == 0 || InBytes.empty())
+    {
+        return {};
+    }
+
+    FKey Key;
+    Key.Hash = FXxHash64::HashBuffer(InBytes.data(), InBytes.size()).Hash;
+    Key.Size = InBytes.size();
+    return Key;
+}
+
+rive::rcp<rive::RenderImage> FRiveAssetCache::FindImage(const FKey& InKey)
+{
+    return Find(Images, InKey);
+}
+
+rive::rcp<rive::Font> FRiveAssetCache::FindFont(const FKey& InKey)
+{
+    return Find(Fonts, InKey);
+}
+
+rive::rcp<rive::RenderImage> FRiveAssetCache::AddImage(
+    const FKey& InKey,
+    rive::rcp<rive::RenderImage> InImage)
+{
+    if (InImage == nullptr)
+    {
+        return nullptr;
+    }
+    // Images are uploaded as 8 bit RGBA
+    const SIZE_T Bytes =
+        static_cast<SIZE_T>(InImage->width()) * InImage->height() * 4;
+    return Add(Images, InKey, MoveTemp(InImage), Bytes);
+}
+
+rive::rcp<rive::Font> FRiveAssetCache::AddFont(const FKey& InKey,
+                                               rive::rcp<rive::Font> InFont)
+{
+    if (InFont == nullptr)
+    {
+        return nullptr;
+    }
+    return Add(Fonts, InKey, MoveTemp(InFont), InKey.Size);
+}
+
+void FRiveAssetCache::Trim()
+{
+    FScopeLock Lock(&EntriesCS);
+    Trim(Images);
+    Trim(Fonts);
+}
+
+template <typename T>
+rive::rcp<T> FRiveAssetCache::Find(TMap<FKey, TEntry<T>>& InEntries,
+                                   const FKey& InKey)
+{
+    FScopeLock Lock(&EntriesCS);
+    TEntry<T>* Entry = InEntries.Find(InKey);
+    if (Entry == nullptr)
+    {
+        INC_DWORD_STAT(STAT_RiveAssetCacheMisses);
+        return nullptr;
+    }
+
+    ++Entry->Hits;
+    INC_DWORD_STAT(STAT_RiveAssetCacheHits);
+    INC_MEMORY_STAT_BY(STAT_RiveAssetCacheDedupMemory, Entry->Bytes);
+    return Entry->Object;
+}
+
+template <typename T>
+rive::rcp<T> FRiveAssetCache::Add(TMap<FKey, TEntry<T>>& InEntries,
+                                  const FKey& InKey,
+                                  rive::rcp<T> InObject,
+                                  SIZE_T InBytes)
+{
+    FScopeLock Lock(&EntriesCS);
+
+    // Someone decoded the same bytes in the meantime, share theirs and let
+    // ours go
+    if (TEntry<T>* Entry = InEntries.Find(InKey))
+    {
+        ++Entry->Hits;
+        INC_MEMORY_STAT_BY(STAT_RiveAssetCacheDedupMemory, Entry->Bytes);
+        return Entry->Object;
+    }
+
+    TEntry<T>& Entry = InEntries.Add(InKey);
+    Entry.Object = MoveTemp(InObject);
+    Entry.Bytes = InBytes;
+    INC_DWORD_STAT(STAT_RiveAssetCacheEntries);
+    INC_MEMORY_STAT_BY(STAT_RiveAssetCacheMemory, InBytes);
+    return Entry.Object;
+}
+
+template <typename T>
+void FRiveAssetCache::Trim(TMap<FKey, TEntry<T>>& InEntries)
+{
+    // Only we can hand out new references, under our lock, so a count of one
+    // can't go up behind our back
+    for (auto It = InEntries.CreateIterator(); It; ++It)
+    {
+        const TEntry<T>& Entry = It.Value();
+        if (Entry.Object->debugging_refcnt() == 1)
+        {
+            DEC_DWORD_STAT(STAT_RiveAssetCacheEntries);
+            DEC_MEMORY_STAT_BY(STAT_RiveAssetCacheMemory, Entry.Bytes);
+            DEC_MEMORY_STAT_BY(STAT_RiveAssetCacheDedupMemory,
+                               Entry.Bytes * Entry.Hits);
+            It.RemoveCurrent();
+        }
+    }
+}
+
+#endif // WITH_RIVE
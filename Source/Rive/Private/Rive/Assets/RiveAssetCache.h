@@ -0,0 +1,111 @@
+// Copyright Rive, Inc. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#if WITH_RIVE
+
+THIRD_PARTY_INCLUDES_START
+#include "rive/refcnt.hpp"
+#include "rive/span.hpp"
+THIRD_PARTY_INCLUDES_END
+
+namespace rive
+{
+class Font;
+class RenderImage;
+} // namespace rive
+
+/**
+ * Decoded images and fonts shared by every Rive file, keyed by the hash of
+ * the bytes they were decoded from, so that the same logo or font embedded in
+ * many files is only decoded and uploaded once.
+ *
+ * The cache holds a reference to each entry and lets go of the ones nobody
+ * else uses anymore on Trim, which files call once they release their native
+ * file. Thread safe, disabled by r.rive.assetcache.
+ */
+class FRiveAssetCache
+{
+    /**
+     * Structor(s)
+     */
+
+public:
+    static FRiveAssetCache& Get();
+
+    /**
+     * Implementation(s)
+     */
+
+public:
+    struct FKey
+    {
+        uint64 Hash = 0;
+        int64 Size = 0;
+
+        bool operator==(const FKey& Other) const
+        {
+            return Hash == Other.Hash && Size == Other.Size;
+        }
+
+        friend uint32 GetTypeHash(const FKey& InKey)
+        {
+            return HashCombine(GetTypeHash(InKey.Hash),
+                               GetTypeHash(InKey.Size));
+        }
+    };
+
+    /** Key of InBytes, unset when the cache is disabled */
+    static TOptional<FKey> MakeKey(const rive::Span<const uint8>& InBytes);
+
+    /** Cached image or font decoded from the bytes of InKey, if any */
+    rive::rcp<rive::RenderImage> FindImage(const FKey& InKey);
+    rive::rcp<rive::Font> FindFont(const FKey& InKey);
+
+    /**
+     * Caches what was decoded from the bytes of InKey
+     * @return The cached one, which is InImage or InFont unless another
+     * thread cached the same bytes first
+     */
+    rive::rcp<rive::RenderImage> AddImage(const FKey& InKey,
+                                          rive::rcp<rive::RenderImage> InImage);
+    rive::rcp<rive::Font> AddFont(const FKey& InKey,
+                                  rive::rcp<rive::Font> InFont);
+
+    /** Releases the entries only the cache references */
+    void Trim();
+
+private:
+    template <typename T> struct TEntry
+    {
+        rive::rcp<T> Object;
+        /** Memory the object takes, encoded size for fonts */
+        SIZE_T Bytes = 0;
+        /** Times it was found instead of decoded again */
+        uint32 Hits = 0;
+    };
+
+    template <typename T>
+    rive::rcp<T> Find(TMap<FKey, TEntry<T>>& InEntries, const FKey& InKey);
+
+    template <typename T>
+    rive::rcp<T> Add(TMap<FKey, TEntry<T>>& InEntries,
+                     const FKey& InKey,
+                     rive::rcp<T> InObject,
+                     SIZE_T InBytes);
+
+    template <typename T> void Trim(TMap<FKey, TEntry<T>>& InEntries);
+
+    /**
+     * Attribute(s)
+     */
+
+private:
+    FCriticalSection EntriesCS;
+    TMap<FKey, TEntry<rive::RenderImage>> Images;
+    TMap<FKey, TEntry<rive::Font>> Fonts;
+};
+
+#endif // WITH_RIVE
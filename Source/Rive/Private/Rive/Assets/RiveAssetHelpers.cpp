@@ -4,6 +4,61 @@
 #include "Rive/Assets/RiveAsset.h"
 #include "Misc/Paths.h"
 
+#if WITH_RIVE
+THIRD_PARTY_INCLUDES_START
+#include "rive/core/binary_reader.hpp"
+#include "rive/generated/assets/file_asset_base.hpp"
+#include "rive/generated/assets/file_asset_contents_base.hpp"
+#include "rive/generated/core_registry.hpp"
+#include "rive/runtime_header.hpp"
+THIRD_PARTY_INCLUDES_END
+#endif // WITH_RIVE
+
+namespace UE::Private::RiveAssetHelpers
+{
+#if WITH_RIVE
+/**
+ * Reads past a property value of the object being read, as File::import does
+ * for properties it doesn't know
+ * @return false if the property type is unknown or the data ends
+ */
+bool SkipProperty(rive::BinaryReader& Reader,
+                  const rive::RuntimeHeader& Header,
+                  uint16 PropertyKey,
+                  uint64& OutUintValue)
+{
+    int FieldId = Header.propertyFieldId(PropertyKey);
+    if (FieldId == -1)
+    {
+        FieldId = rive::CoreRegistry::propertyFieldId(PropertyKey);
+    }
+
+    switch (FieldId)
+    {
+        // Uint and bool, bools are a single 0 or 1 byte
+        case 0:
+            OutUintValue = Reader.readVarUint64();
+            break;
+        // String and bytes
+        case 1:
+            Reader.readBytes();
+            break;
+        // Double
+        case 2:
+            Reader.readFloat32();
+            break;
+        // Color
+        case 3:
+            Reader.readUint32();
+            break;
+        default:
+            return false;
+    }
+    return !Reader.hasError();
+}
+#endif // WITH_RIVE
+} // namespace UE::Private::RiveAssetHelpers
+
 TArray<FString> RiveAssetHelpers::AssetPaths(
     const FString& InBasePath,
     URiveAsset* InRiveAsset,
@@ -104,3 +159,84 @@ ERiveAssetType RiveAssetHelpers::GetUnrealType(uint16_t RiveType)
             return ERiveAssetType::None;
     }
 }
+
+bool RiveAssetHelpers::StripInBandAssets(TConstArrayView<uint8> InFileData,
+                                         const TSet<uint32>& InAssetIds,
+                                         TArray<uint8>& OutFileData,
+                                         TArray<uint32>& OutStrippedAssetIds)
+{
+    OutFileData.Reset();
+    OutStrippedAssetIds.Reset();
+
+#if WITH_RIVE
+    rive::BinaryReader Reader(
+        rive::make_span(InFileData.GetData(), InFileData.Num()));
+    rive::RuntimeHeader Header;
+    if (!rive::RuntimeHeader::read(Reader, Header))
+    {
+        return false;
+    }
+
+    const uint8* FileStart = InFileData.GetData();
+    OutFileData.Reserve(InFileData.Num());
+    OutFileData.Append(FileStart, Reader.position() - FileStart);
+
+    // Contents belong to the asset right before them
+    TOptional<uint32> CurrentAssetId;
+    while (!Reader.reachedEnd())
+    {
+        const uint8* ObjectStart = Reader.position();
+        const uint16 TypeKey = Reader.readVarUintAs<uint16>();
+        const bool bIsAsset = GetUnrealType(TypeKey) != ERiveAssetType::None;
+        uint64 AssetId = 0;
+
+        for (uint16 PropertyKey = Reader.readVarUintAs<uint16>();
+             PropertyKey != 0;
+             PropertyKey = Reader.readVarUintAs<uint16>())
+        {
+            uint64 Value = 0;
+            if (!UE::Private::RiveAssetHelpers::SkipProperty(Reader,
+                                                             Header,
+                                                             PropertyKey,
+                                                             Value))
+            {
+                OutFileData.Reset();
+                OutStrippedAssetIds.Reset();
+                return false;
+            }
+            if (bIsAsset &&
+                PropertyKey == rive::FileAssetBase::assetIdPropertyKey)
+            {
+                AssetId = Value;
+            }
+        }
+        if (Reader.hasError())
+        {
+            OutFileData.Reset();
+            OutStrippedAssetIds.Reset();
+            return false;
+        }
+
+        if (TypeKey == rive::FileAssetContentsBase::typeKey &&
+            CurrentAssetId.IsSet() && InAssetIds.Contains(*CurrentAssetId))
+        {
+            OutStrippedAssetIds.Add(*CurrentAssetId);
+            CurrentAssetId.Reset();
+            continue;
+        }
+
+        if (bIsAsset)
+        {
+            CurrentAssetId = static_cast<uint32>(AssetId);
+        }
+        else
+        {
+            CurrentAssetId.Reset();
+        }
+        OutFileData.Append(ObjectStart, Reader.position() - ObjectStart);
+    }
+    return true;
+#else
+    return false;
+#endif // WITH_RIVE
+}
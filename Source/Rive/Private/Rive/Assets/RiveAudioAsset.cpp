@@ -9,16 +9,19 @@ THIRD_PARTY_INCLUDES_END
 
 URiveAudioAsset::URiveAudioAsset() { Type = ERiveAssetType::Audio; }
 
-bool URiveAudioAsset::LoadNativeAssetBytes(
+TUniqueFunction<bool()> URiveAudioAsset::DecodeNativeAsset(
     rive::FileAsset& InAsset,
     rive::Factory* InRiveFactory,
-    const rive::Span<const uint8>& AssetBytes)
+    const rive::Span<const uint8>& AssetBytes) const
 {
     rive::SimpleArray<uint8_t> Data =
         rive::SimpleArray(AssetBytes.data(), AssetBytes.count());
-    rive::AudioSource* AudioSource = new rive::AudioSource(Data);
-    rive::AudioAsset* AudioAsset = InAsset.as<rive::AudioAsset>();
-    AudioAsset->audioSource(ref_rcp(AudioSource));
-    NativeAsset = AudioAsset;
-    return true;
+    rive::rcp<rive::AudioSource> AudioSource =
+        ref_rcp(new rive::AudioSource(Data));
+
+    return [&InAsset, AudioSource = MoveTemp(AudioSource)]() -> bool {
+        rive::AudioAsset* AudioAsset = InAsset.as<rive::AudioAsset>();
+        AudioAsset->audioSource(AudioSource);
+        return true;
+    };
 }
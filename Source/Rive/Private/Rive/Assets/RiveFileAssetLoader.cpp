@@ -10,6 +10,8 @@
 #include "Rive/Assets/RiveAudioAsset.h"
 #include "Rive/Assets/RiveFontAsset.h"
 #include "Rive/Assets/RiveImageAsset.h"
+#include "Modules/ModuleManager.h"
+#include "Stats/RiveStats.h"
 #include "UObject/Package.h"
 #include "UObject/SavePackage.h"
 
@@ -22,9 +24,17 @@ THIRD_PARTY_INCLUDES_START
 THIRD_PARTY_INCLUDES_END
 #endif // WITH_RIVE
 
+static TAutoConsoleVariable<int32> CVarRiveParallelDecode(
+    TEXT("r.rive.paralleldecode"),
+    1,
+    TEXT("If non 0, the assets embedded in or referenced by a Rive file are "
+         "decoded on tasks of their own while the file imports. Creating "
+         "their GPU resources stays serial."),
+    ECVF_Default);
+
 namespace UE::Private::RiveFileAssetLoader
 {
-bool NeedsClassReplacement(URiveAsset* RiveAsset)
+bool NeedsClassReplacement(const URiveAsset* RiveAsset)
 {
     switch (RiveAsset->Type)
     {
@@ -60,6 +70,21 @@ bool NeedsClassReplacement(URiveAsset* RiveAsset)
     return false;
 }
 
+UClass* GetAssetClass(ERiveAssetType InType)
+{
+    switch (InType)
+    {
+        case ERiveAssetType::Font:
+            return URiveFontAsset::StaticClass();
+        case ERiveAssetType::Audio:
+            return URiveAudioAsset::StaticClass();
+        case ERiveAssetType::Image:
+            return URiveImageAsset::StaticClass();
+        default:
+            return URiveAsset::StaticClass();
+    }
+}
+
 URiveAsset* ReplaceAsset(UObject* Outer, URiveAsset* RiveAsset)
 {
     URiveAsset* NewAsset = nullptr;
@@ -134,7 +159,10 @@ FRiveFileAssetLoader::FRiveFileAssetLoader(
     UObject* InOuter,
     TMap<uint32, TObjectPtr<URiveAsset>>& InAssets) :
     Outer(InOuter), Assets(InAssets)
-{}
+{
+    // Decoders load the modules they need, which only the game thread can do
+    FModuleManager::Get().LoadModule(TEXT("ImageWrapper"));
+}
 
 #if WITH_RIVE
 
@@ -148,118 +176,190 @@ bool FRiveFileAssetLoader::loadContents(rive::FileAsset& InAsset,
         return true;
     }
 
-    const rive::Span<const uint8>* AssetBytes = &InBandBytes;
-    const bool bUseInBand = InBandBytes.size() > 0;
+    rive::Span<const uint8> AssetBytes = InBandBytes;
+    const ERiveAssetType Type =
+        RiveAssetHelpers::GetUnrealType(InAsset.coreType());
 
     // We can take two paths here
     // 1. Either search for a file to load off disk (or in the Unreal registry)
     // 2. Or use InBandbytes if no other options are found to load
-    // Unity version prefers disk assets, over InBand, if they exist, allowing
-    // overrides
+    // Like the Unity version, we prefer disk assets over InBand if they exist,
+    // allowing overrides. Cooking strips the InBand bytes they override.
 
-    URiveAsset* RiveAsset = nullptr;
+    // This may run off the game thread, URiveAssets are only read here
+    const URiveAsset* RiveAsset = nullptr;
     const TObjectPtr<URiveAsset>* RiveAssetPtr = Assets.Find(InAsset.assetId());
     if (RiveAssetPtr != nullptr && RiveAssetPtr->Get() != nullptr)
     {
         RiveAsset = RiveAssetPtr->Get();
+    }
 
-        if (UE::Private::RiveFileAssetLoader::NeedsClassReplacement(RiveAsset))
-        {
-            if (URiveAsset* NewAsset =
-                    UE::Private::RiveFileAssetLoader::ReplaceAsset(Outer,
-                                                                   RiveAsset))
-            {
-                RiveAsset = NewAsset;
-                Assets[InAsset.assetId()] = NewAsset;
-            }
-        }
+    const bool bUseInBand =
+        InBandBytes.size() > 0 &&
+        (RiveAsset == nullptr || RiveAsset->NativeAssetBytes.IsEmpty());
+    if (RiveAsset == nullptr && !bUseInBand)
+    {
+        UE_LOG(LogRive,
+               Error,
+               TEXT("Could not find pre-loaded asset. This means the "
+                    "initial import probably "
+                    "failed."));
+        return false;
     }
-    else
+
+    if (!bUseInBand)
     {
-        if (!bUseInBand)
+        if (RiveAsset->NativeAssetBytes.IsEmpty())
         {
             UE_LOG(LogRive,
                    Error,
-                   TEXT("Could not find pre-loaded asset. This means the "
-                        "initial import probably "
-                        "failed."));
+                   TEXT("Trying to load out of band asset, but its bytes were "
+                        "never filled."));
             return false;
         }
+        AssetBytes = rive::make_span(RiveAsset->NativeAssetBytes.GetData(),
+                                     RiveAsset->NativeAssetBytes.Num());
+    }
+
+    // Assets yet to be created, or replaced by one of the right class, decode
+    // with the defaults of the class they will have
+    const URiveAsset* Decoder = RiveAsset;
+    if (Decoder == nullptr ||
+        UE::Private::RiveFileAssetLoader::NeedsClassReplacement(RiveAsset))
+    {
+        Decoder = UE::Private::RiveFileAssetLoader::GetAssetClass(Type)
+                      ->GetDefaultObject<URiveAsset>();
+    }
+
+    FLoadedAsset& LoadedAsset = LoadedAssets.AddDefaulted_GetRef();
+    LoadedAsset.NativeAsset = &InAsset;
+    LoadedAsset.Type = Type;
+
+    if (CVarRiveParallelDecode.GetValueOnAnyThread() != 0 &&
+        FPlatformProcess::SupportsMultithreading())
+    {
+        // The bytes outlive the task, they belong to the file or its assets,
+        // which wait for the import to be done with them
+        INC_DWORD_STAT(STAT_RiveParallelAssetDecodes);
+        LoadedAsset.DecodeTask = UE::Tasks::Launch(
+            TEXT("Rive.DecodeAsset"),
+            [Decoder, &InAsset, InFactory, AssetBytes]() {
+                SCOPE_CYCLE_COUNTER(STAT_RiveAssetDecode);
+                return Decoder->DecodeNativeAsset(InAsset,
+                                                  InFactory,
+                                                  AssetBytes);
+            });
+        return true;
+    }
+
+    TUniqueFunction<bool()> HandOver;
+    {
+        SCOPE_CYCLE_COUNTER(STAT_RiveAssetDecode);
+        HandOver = Decoder->DecodeNativeAsset(InAsset, InFactory, AssetBytes);
+    }
+    // Failures are reported by the decoder. Like on the parallel path, we
+    // keep the asset ours, rather than have the runtime decode the same bytes
+    // again through the factory without the render context lock.
+    LoadedAsset.bDecoded = HandOver && HandOver();
+    return true;
+}
 
-        ERiveAssetType Type =
-            RiveAssetHelpers::GetUnrealType(InAsset.coreType());
-        switch (Type)
+void FRiveFileAssetLoader::FinishDecoding(bool bInImported)
+{
+    // Wait for the decoders running in parallel
+    TArray<TUniqueFunction<bool()>> HandOvers;
+    HandOvers.SetNum(LoadedAssets.Num());
+    for (int32 Index = 0; Index < LoadedAssets.Num(); ++Index)
+    {
+        FLoadedAsset& LoadedAsset = LoadedAssets[Index];
+        if (LoadedAsset.DecodeTask.IsValid())
         {
-            case ERiveAssetType::Audio:
-                RiveAsset = NewObject<URiveAudioAsset>(
-                    Outer,
-                    URiveAudioAsset::StaticClass(),
-                    MakeUniqueObjectName(
-                        Outer,
-                        URiveAudioAsset::StaticClass(),
-                        FName{FString::Printf(TEXT("%d"), InAsset.assetId())}),
-                    RF_Transient);
-                break;
-            case ERiveAssetType::Font:
-                RiveAsset = NewObject<URiveFontAsset>(
-                    Outer,
-                    URiveFontAsset::StaticClass(),
-                    MakeUniqueObjectName(
-                        Outer,
-                        URiveFontAsset::StaticClass(),
-                        FName{FString::Printf(TEXT("%d"), InAsset.assetId())}),
-                    RF_Transient);
-                break;
-            case ERiveAssetType::Image:
-                RiveAsset = NewObject<URiveImageAsset>(
-                    Outer,
-                    URiveImageAsset::StaticClass(),
-                    MakeUniqueObjectName(
-                        Outer,
-                        URiveImageAsset::StaticClass(),
-                        FName{FString::Printf(TEXT("%d"), InAsset.assetId())}),
-                    RF_Transient);
-                break;
-            default:
-                RiveAsset = NewObject<URiveAsset>(
-                    Outer,
-                    URiveAsset::StaticClass(),
-                    MakeUniqueObjectName(
-                        Outer,
-                        URiveAsset::StaticClass(),
-                        FName{FString::Printf(TEXT("%d"), InAsset.assetId())}),
-                    RF_Transient);
-                break;
+            HandOvers[Index] = MoveTemp(LoadedAsset.DecodeTask.GetResult());
+            LoadedAsset.DecodeTask = {};
         }
+    }
 
-        RiveAsset->Id = InAsset.assetId();
-        RiveAsset->Name = FString(UTF8_TO_TCHAR(InAsset.name().c_str()));
-        RiveAsset->Type = Type;
-        RiveAsset->bIsInBand = true;
+    // The native assets are gone along with the file when it didn't import
+    if (!bInImported)
+    {
+        return;
+    }
 
-        // We only add it to our assets here so that it shows up in the
-        // inspector, otherwise this doesn't have any functional effect on
-        // anything due to it being a transient, in-band asset
-        Assets.Add(InAsset.assetId(), RiveAsset);
+    // Hand overs creating GPU resources lock the render context themselves,
+    // only for as long as they use it
+    for (int32 Index = 0; Index < LoadedAssets.Num(); ++Index)
+    {
+        if (HandOvers[Index])
+        {
+            LoadedAssets[Index].bDecoded = HandOvers[Index]();
+        }
     }
+}
 
-    rive::Span<const uint8> OutOfBandBytes;
-    if (!bUseInBand)
+void FRiveFileAssetLoader::FinishLoading()
+{
+    check(IsInGameThread());
+
+    for (const FLoadedAsset& LoadedAsset : LoadedAssets)
     {
-        if (RiveAsset->NativeAssetBytes.IsEmpty())
+        // Failed to decode, already logged by the decoder
+        if (!LoadedAsset.bDecoded)
         {
-            UE_LOG(LogRive,
-                   Error,
-                   TEXT("Trying to load out of band asset, but its bytes were "
-                        "never filled."));
-            return false;
+            continue;
         }
-        OutOfBandBytes = rive::make_span(RiveAsset->NativeAssetBytes.GetData(),
-                                         RiveAsset->NativeAssetBytes.Num());
-        AssetBytes = &OutOfBandBytes;
+
+        const rive::FileAsset& NativeAsset = *LoadedAsset.NativeAsset;
+        const uint32 AssetId = NativeAsset.assetId();
+
+        URiveAsset* RiveAsset = nullptr;
+        const TObjectPtr<URiveAsset>* RiveAssetPtr = Assets.Find(AssetId);
+        if (RiveAssetPtr != nullptr && RiveAssetPtr->Get() != nullptr)
+        {
+            RiveAsset = RiveAssetPtr->Get();
+
+            if (UE::Private::RiveFileAssetLoader::NeedsClassReplacement(
+                    RiveAsset))
+            {
+                if (URiveAsset* NewAsset =
+                        UE::Private::RiveFileAssetLoader::ReplaceAsset(
+                            Outer,
+                            RiveAsset))
+                {
+                    RiveAsset = NewAsset;
+                    Assets[AssetId] = NewAsset;
+                }
+            }
+        }
+        else
+        {
+            UClass* AssetClass =
+                UE::Private::RiveFileAssetLoader::GetAssetClass(
+                    LoadedAsset.Type);
+            RiveAsset = NewObject<URiveAsset>(
+                Outer,
+                AssetClass,
+                MakeUniqueObjectName(
+                    Outer,
+                    AssetClass,
+                    FName{FString::Printf(TEXT("%d"), AssetId)}),
+                RF_Transient);
+
+            RiveAsset->Id = AssetId;
+            RiveAsset->Name =
+                FString(UTF8_TO_TCHAR(NativeAsset.name().c_str()));
+            RiveAsset->Type = LoadedAsset.Type;
+            RiveAsset->bIsInBand = true;
+
+            // We only add it to our assets here so that it shows up in the
+            // inspector, otherwise this doesn't have any functional effect on
+            // anything due to it being a transient, in-band asset
+            Assets.Add(AssetId, RiveAsset);
+        }
+
+        RiveAsset->NativeAsset = LoadedAsset.NativeAsset;
     }
 
-    return RiveAsset->LoadNativeAssetBytes(InAsset, InFactory, *AssetBytes);
+    LoadedAssets.Empty();
 }
 
 #endif // WITH_RIVE
@@ -6,6 +6,8 @@
 #include "IRiveRendererModule.h"
 #include "Engine/FontFace.h"
 #include "Logs/RiveLog.h"
+#include "Rive/Assets/RiveAssetCache.h"
+#include "Rive/Assets/RiveTextShapeCache.h"
 
 THIRD_PARTY_INCLUDES_START
 #include "rive/renderer/render_context.hpp"
@@ -75,26 +77,49 @@ void URiveFontAsset::LoadFontBytes(const TArray<uint8>& InBytes)
 
                     rive::FontAsset* FontAsset =
                         NativeAsset->as<rive::FontAsset>();
-                    FontAsset->font(DecodedFont);
+                    FontAsset->font(
+                        FRiveTextShapeCache::WrapFont(MoveTemp(DecodedFont)));
                 }
             }));
 }
 
-bool URiveFontAsset::LoadNativeAssetBytes(
+TUniqueFunction<bool()> URiveFontAsset::DecodeNativeAsset(
     rive::FileAsset& InAsset,
     rive::Factory* InRiveFactory,
-    const rive::Span<const uint8>& AssetBytes)
+    const rive::Span<const uint8>& AssetBytes) const
 {
-    rive::rcp<rive::Font> DecodedFont = InRiveFactory->decodeFont(AssetBytes);
-
+    // Fonts are parsed on the CPU only, the whole decode can happen here,
+    // unless another file embedded the same bytes already
+    const TOptional<FRiveAssetCache::FKey> CacheKey =
+        FRiveAssetCache::MakeKey(AssetBytes);
+    rive::rcp<rive::Font> DecodedFont;
+    if (CacheKey.IsSet())
+    {
+        DecodedFont = FRiveAssetCache::Get().FindFont(CacheKey.GetValue());
+    }
     if (DecodedFont == nullptr)
     {
-        UE_LOG(LogRive, Error, TEXT("Could not decode font asset: %s"), *Name);
-        return false;
+        DecodedFont = FRiveTextShapeCache::WrapFont(
+            InRiveFactory->decodeFont(AssetBytes));
+        if (DecodedFont != nullptr && CacheKey.IsSet())
+        {
+            DecodedFont = FRiveAssetCache::Get().AddFont(CacheKey.GetValue(),
+                                                         DecodedFont);
+        }
     }
 
-    rive::FontAsset* FontAsset = InAsset.as<rive::FontAsset>();
-    FontAsset->font(DecodedFont);
-    NativeAsset = FontAsset;
-    return true;
+    return [&InAsset, DecodedFont = MoveTemp(DecodedFont)]() -> bool {
+        if (DecodedFont == nullptr)
+        {
+            UE_LOG(LogRive,
+                   Error,
+                   TEXT("Could not decode font asset: %s"),
+                   UTF8_TO_TCHAR(InAsset.name().c_str()));
+            return false;
+        }
+
+        rive::FontAsset* FontAsset = InAsset.as<rive::FontAsset>();
+        FontAsset->font(DecodedFont);
+        return true;
+    };
 }
@@ -7,6 +7,7 @@
 #include "IRiveRenderer.h"
 #include "IRiveRendererModule.h"
 #include "Logs/RiveLog.h"
+#include "Rive/Assets/RiveAssetCache.h"
 
 #include "Engine/Texture2D.h"
 #include "Engine/Texture.h"
@@ -62,15 +63,14 @@ void GetTextureData(UTexture2D* Texture, TArray<uint8>& OutData)
 
     Mip.BulkData.Unlock();
 }
-} // namespace UE::Private::RiveImageAsset
-
-URiveImageAsset::URiveImageAsset() { Type = ERiveAssetType::Image; }
 
-void URiveImageAsset::LoadTexture(UTexture2D* InTexture)
+/**
+ * Copies the pixels of a single mip, uncompressed texture and decodes them
+ * again as an image
+ */
+rive::rcp<rive::RenderImage> DecodeTexture(IRiveRenderer* RiveRenderer,
+                                           UTexture2D* InTexture)
 {
-    if (!InTexture)
-        return;
-
     { // Ensure we have a single mip
         int32 MipCount = InTexture->GetNumMips();
         if (MipCount != 1)
@@ -83,7 +83,7 @@ void URiveImageAsset::LoadTexture(UTexture2D* InTexture)
                         "'NoMipMaps', or 'Mip "
                         "Gen Settings' to 'FromTextureGroup' AND 'Texture "
                         "Group' set to 'UI'"));
-            return;
+            return nullptr;
         }
     }
 
@@ -96,52 +96,83 @@ void URiveImageAsset::LoadTexture(UTexture2D* InTexture)
                    TEXT("LoadTexture: Texture needs to be set to have a "
                         "'CompressionSetting' of "
                         "'UserInterface2D'"));
-            return;
+            return nullptr;
         }
     }
 
+    rive::gpu::RenderContext* RenderContext;
+    {
+        FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
+        RenderContext = RiveRenderer->GetRenderContext();
+    }
+
+    if (!ensure(RenderContext))
+    {
+        return nullptr;
+    }
+
+    TArray<uint8> ImageData;
+    GetTextureData(InTexture, ImageData);
+
+    if (ImageData.IsEmpty())
+    {
+        UE_LOG(LogRive,
+               Error,
+               TEXT("LoadTexture: Could not get raw bitmap "
+                    "data from Texture."));
+        return nullptr;
+    }
+
+    TArray64<uint8> CompressedImage;
+    FImageView ImageView = FImageView(ImageData.GetData(),
+                                      InTexture->GetSizeX(),
+                                      InTexture->GetSizeY(),
+                                      ERawImageFormat::BGRA8);
+    IImageWrapperModule& ImageWrapperModule =
+        FModuleManager::LoadModuleChecked<IImageWrapperModule>(
+            FName("ImageWrapper"));
+    ImageWrapperModule.CompressImage(CompressedImage,
+                                     EImageFormat::PNG,
+                                     ImageView,
+                                     100);
+    return RenderContext->decodeImage(
+        rive::make_span(CompressedImage.GetData(), CompressedImage.Num()));
+}
+} // namespace UE::Private::RiveImageAsset
+
+URiveImageAsset::URiveImageAsset() { Type = ERiveAssetType::Image; }
+
+void URiveImageAsset::LoadTexture(UTexture2D* InTexture)
+{
+    if (!InTexture)
+        return;
+
     IRiveRenderer* RiveRenderer = IRiveRendererModule::Get().GetRenderer();
 
     RiveRenderer->CallOrRegister_OnInitialized(
         IRiveRenderer::FOnRendererInitialized::FDelegate::CreateLambda(
             [this, InTexture](IRiveRenderer* RiveRenderer) {
-                rive::gpu::RenderContext* RenderContext;
+                rive::rcp<rive::RenderImage> RenderImage;
                 {
                     FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
-                    RenderContext = RiveRenderer->GetRenderContext();
+                    RenderImage = RiveRenderer->MakeImageFromTexture(InTexture);
                 }
 
-                if (ensure(RenderContext))
+                if (RenderImage)
                 {
-                    TArray<uint8> ImageData;
-                    UE::Private::RiveImageAsset::GetTextureData(InTexture,
-                                                                ImageData);
-
-                    if (ImageData.IsEmpty())
-                    {
-                        UE_LOG(LogRive,
-                               Error,
-                               TEXT("LoadTexture: Could not get raw bitmap "
-                                    "data from Texture."));
-                        return;
-                    }
+                    LoadedTexture = InTexture;
+                }
+                else
+                {
+                    // Renderers that can't sample it in place get a copy
+                    RenderImage = UE::Private::RiveImageAsset::DecodeTexture(
+                        RiveRenderer,
+                        InTexture);
+                    LoadedTexture = nullptr;
+                }
 
-                    TArray64<uint8> CompressedImage;
-                    FImageView ImageView = FImageView(ImageData.GetData(),
-                                                      InTexture->GetSizeX(),
-                                                      InTexture->GetSizeY(),
-                                                      ERawImageFormat::BGRA8);
-                    IImageWrapperModule& ImageWrapperModule =
-                        FModuleManager::LoadModuleChecked<IImageWrapperModule>(
-                            FName("ImageWrapper"));
-                    ImageWrapperModule.CompressImage(CompressedImage,
-                                                     EImageFormat::PNG,
-                                                     ImageView,
-                                                     100);
-                    rive::rcp<rive::RenderImage> RenderImage =
-                        RenderContext->decodeImage(
-                            rive::make_span(CompressedImage.GetData(),
-                                            CompressedImage.Num()));
+                if (RenderImage)
+                {
                     NativeAsset->as<rive::ImageAsset>()->renderImage(
                         RenderImage);
                 }
@@ -184,22 +215,102 @@ void URiveImageAsset::LoadImageBytes(const TArray<uint8>& InBytes)
             }));
 }
 
-bool URiveImageAsset::LoadNativeAssetBytes(
+TUniqueFunction<bool()> URiveImageAsset::DecodeNativeAsset(
     rive::FileAsset& InAsset,
     rive::Factory* InRiveFactory,
-    const rive::Span<const uint8>& AssetBytes)
+    const rive::Span<const uint8>& AssetBytes) const
 {
-    rive::rcp<rive::RenderImage> DecodedImage =
-        InRiveFactory->decodeImage(AssetBytes);
+    // Another file may have embedded the same bytes already
+    const TOptional<FRiveAssetCache::FKey> CacheKey =
+        FRiveAssetCache::MakeKey(AssetBytes);
+    if (CacheKey.IsSet())
+    {
+        if (rive::rcp<rive::RenderImage> CachedImage =
+                FRiveAssetCache::Get().FindImage(CacheKey.GetValue()))
+        {
+            return [&InAsset, CachedImage = MoveTemp(CachedImage)]() -> bool {
+                InAsset.as<rive::ImageAsset>()->renderImage(CachedImage);
+                return true;
+            };
+        }
+    }
+
+    // Decompress PNG and JPEG here when the renderer can take the pixels,
+    // leaving only the texture creation to the hand over. Anything else goes
+    // through the factory there.
+    int32 Width = 0;
+    int32 Height = 0;
+    TArray<uint8> PixelsBGRA8;
 
-    if (DecodedImage == nullptr)
+    IRiveRenderer* RiveRenderer = IRiveRendererModule::Get().GetRenderer();
+    IImageWrapperModule* ImageWrapperModule =
+        FModuleManager::GetModulePtr<IImageWrapperModule>(
+            FName("ImageWrapper"));
+    if (RiveRenderer && RiveRenderer->CanMakeImage() && ImageWrapperModule)
     {
-        UE_LOG(LogRive, Error, TEXT("Could not decode image asset: %s"), *Name);
-        return false;
+        const EImageFormat Format = ImageWrapperModule->DetectImageFormat(
+            AssetBytes.data(),
+            AssetBytes.size());
+        if (Format == EImageFormat::PNG || Format == EImageFormat::JPEG)
+        {
+            TSharedPtr<IImageWrapper> ImageWrapper =
+                ImageWrapperModule->CreateImageWrapper(Format);
+            if (ImageWrapper.IsValid() &&
+                ImageWrapper->SetCompressed(AssetBytes.data(),
+                                            AssetBytes.size()) &&
+                ImageWrapper->GetRaw(ERGBFormat::BGRA, 8, PixelsBGRA8))
+            {
+                Width = ImageWrapper->GetWidth();
+                Height = ImageWrapper->GetHeight();
+            }
+            else
+            {
+                PixelsBGRA8.Empty();
+            }
+        }
     }
 
-    rive::ImageAsset* ImageAsset = InAsset.as<rive::ImageAsset>();
-    ImageAsset->renderImage(DecodedImage);
-    NativeAsset = ImageAsset;
-    return true;
+    return [&InAsset,
+            InRiveFactory,
+            AssetBytes,
+            RiveRenderer,
+            Width,
+            Height,
+            PixelsBGRA8 = MoveTemp(PixelsBGRA8),
+            CacheKey]() -> bool {
+        rive::rcp<rive::RenderImage> DecodedImage;
+        {
+            // The factory is the renderer's render context, which the
+            // rendering thread uses too. Only the texture creation holds it.
+            FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
+            if (!PixelsBGRA8.IsEmpty())
+            {
+                DecodedImage =
+                    RiveRenderer->MakeImage(Width, Height, PixelsBGRA8);
+            }
+            if (DecodedImage == nullptr)
+            {
+                DecodedImage = InRiveFactory->decodeImage(AssetBytes);
+            }
+        }
+
+        if (DecodedImage == nullptr)
+        {
+            UE_LOG(LogRive,
+                   Error,
+                   TEXT("Could not decode image asset: %s"),
+                   UTF8_TO_TCHAR(InAsset.name().c_str()));
+            return false;
+        }
+
+        if (CacheKey.IsSet())
+        {
+            DecodedImage = FRiveAssetCache::Get().AddImage(CacheKey.GetValue(),
+                                                           DecodedImage);
+        }
+
+        rive::ImageAsset* ImageAsset = InAsset.as<rive::ImageAsset>();
+        ImageAsset->renderImage(DecodedImage);
+        return true;
+    };
 }
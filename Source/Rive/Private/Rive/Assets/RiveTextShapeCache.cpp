@@ -0,0 +1,281 @@
+// Copyright Rive, Inc. All rights reserved.
+
+#include "Rive/Assets/RiveTextShapeCache.h"
+
+#include "Hash/xxhash.h"
+#include "Stats/RiveStats.h"
+
+#if WITH_RIVE
+
+static TAutoConsoleVariable<int32> CVarRiveTextShapeCacheSize(
+    TEXT("r.rive.textshapecache.size"),
+    256,
+    TEXT("Number of shaped texts kept for Rive text runs that go back to a "
+         "value they had before. 0 shapes every change again."),
+    ECVF_Default);
+
+namespace UE::Private::RiveTextShapeCache
+{
+/**
+ * Forwards to the font it wraps, shaping through FRiveTextShapeCache. The
+ * fonts it wraps shape runs by casting their fonts to their own type, so
+ * runs are handed to them unwrapped, which is why wrappers are registered.
+ */
+class FCachingFont : public rive::Font
+{
+    /**
+     * Structor(s)
+     */
+
+public:
+    explicit FCachingFont(rive::rcp<rive::Font> InFont) :
+        rive::Font(InFont->lineMetrics()), InnerFont(MoveTemp(InFont))
+    {
+        FScopeLock Lock(&WrappersCS);
+        Wrappers.Add(this);
+    }
+
+    virtual ~FCachingFont() override
+    {
+        {
+            FScopeLock Lock(&WrappersCS);
+            Wrappers.Remove(this);
+        }
+
+        // Cached texts hold on to the font we wrap, nobody can shape with it
+        // through us anymore
+        FRiveTextShapeCache::Get().RemoveFont(InnerFont.get());
+    }
+
+    /**
+     * Implementation(s)
+     */
+
+public:
+    /** The font InFont wraps, or InFont when it isn't a wrapper */
+    static const rive::rcp<rive::Font>& Unwrap(
+        const rive::rcp<rive::Font>& InFont)
+    {
+        {
+            FScopeLock Lock(&WrappersCS);
+            if (!Wrappers.Contains(InFont.get()))
+            {
+                return InFont;
+            }
+        }
+        return static_cast<const FCachingFont*>(InFont.get())->InnerFont;
+    }
+
+    //~ BEGIN : rive::Font Interface
+
+public:
+    virtual uint16_t getAxisCount() const override
+    {
+        return InnerFont->getAxisCount();
+    }
+
+    virtual Axis getAxis(uint16_t index) const override
+    {
+        return InnerFont->getAxis(index);
+    }
+
+    virtual float getAxisValue(uint32_t axisTag) const override
+    {
+        return InnerFont->getAxisValue(axisTag);
+    }
+
+    virtual rive::SimpleArray<uint32_t> features() const override
+    {
+        return InnerFont->features();
+    }
+
+    virtual bool hasGlyph(rive::Span<const rive::Unichar> text) const override
+    {
+        return InnerFont->hasGlyph(text);
+    }
+
+    virtual uint32_t getFeatureValue(uint32_t featureTag) const override
+    {
+        return InnerFont->getFeatureValue(featureTag);
+    }
+
+    virtual rive::rcp<rive::Font> withOptions(
+        rive::Span<const Coord> variableAxes,
+        rive::Span<const Feature> features) const override
+    {
+        return FRiveTextShapeCache::WrapFont(
+            InnerFont->withOptions(variableAxes, features));
+    }
+
+    virtual rive::RawPath getPath(rive::GlyphID id) const override
+    {
+        return InnerFont->getPath(id);
+    }
+
+protected:
+    virtual rive::SimpleArray<rive::Paragraph> onShapeText(
+        rive::Span<const rive::Unichar> text,
+        rive::Span<const rive::TextRun> runs) const override
+    {
+        return FRiveTextShapeCache::Get().ShapeText(text, runs);
+    }
+
+    //~ END : rive::Font Interface
+
+    /**
+     * Attribute(s)
+     */
+
+private:
+    rive::rcp<rive::Font> InnerFont;
+
+    static FCriticalSection WrappersCS;
+    static TSet<const rive::Font*> Wrappers;
+};
+
+FCriticalSection FCachingFont::WrappersCS;
+TSet<const rive::Font*> FCachingFont::Wrappers;
+} // namespace UE::Private::RiveTextShapeCache
+
+FRiveTextShapeCache& FRiveTextShapeCache::Get()
+{
+    static FRiveTextShapeCache Instance;
+    return Instance;
+}
+
+FRiveTextShapeCache::FRiveTextShapeCache() :
+    Cache(FMath::Max(CVarRiveTextShapeCacheSize.GetValueOnAnyThread(), 1))
+{}
+
+rive::rcp<rive::Font> FRiveTextShapeCache::WrapFont(
+    rive::rcp<rive::Font> InFont)
+{
+    using UE::Private::RiveTextShapeCache::FCachingFont;
+
+    if (InFont == nullptr || FCachingFont::Unwrap(InFont) != InFont)
+    {
+        return InFont;
+    }
+    return rive::make_rcp<FCachingFont>(MoveTemp(InFont));
+}
+
+rive::SimpleArray<rive::Paragraph> FRiveTextShapeCache::ShapeText(
+    rive::Span<const rive::Unichar> InText,
+    rive::Span<const rive::TextRun> InRuns)
+{
+    using UE::Private::RiveTextShapeCache::FCachingFont;
+
+    if (InRuns.empty())
+    {
+        return {};
+    }
+
+    TArray<rive::TextRun> Runs(InRuns.data(), InRuns.size());
+    for (rive::TextRun& Run : Runs)
+    {
+        Run.font = FCachingFont::Unwrap(Run.font);
+    }
+    const rive::rcp<rive::Font> Font = Runs[0].font;
+
+    const int32 MaxEntries = CVarRiveTextShapeCacheSize.GetValueOnAnyThread();
+    if (MaxEntries <= 0)
+    {
+        SCOPE_CYCLE_COUNTER(STAT_RiveTextShaping);
+        return Font->shapeText(InText,
+                               rive::make_span(Runs.GetData(), Runs.Num()));
+    }
+
+    FKey Key(InText, MoveTemp(Runs));
+    {
+        FScopeLock Lock(&CacheCS);
+        if (Cache.Max() != MaxEntries)
+        {
+            Cache.Empty(MaxEntries);
+        }
+        if (const FParagraphs* Found = Cache.FindAndTouch(Key))
+        {
+            INC_DWORD_STAT(STAT_RiveTextShapeCacheHits);
+            return rive::SimpleArray<rive::Paragraph>(**Found);
+        }
+    }
+
+    INC_DWORD_STAT(STAT_RiveTextShapeCacheMisses);
+    FParagraphs Paragraphs;
+    {
+        SCOPE_CYCLE_COUNTER(STAT_RiveTextShaping);
+        Paragraphs = MakeShared<const rive::SimpleArray<rive::Paragraph>,
+                                ESPMode::ThreadSafe>(Font->shapeText(
+            InText,
+            rive::make_span(Key.Runs.GetData(), Key.Runs.Num())));
+    }
+
+    {
+        FScopeLock Lock(&CacheCS);
+        Cache.Add(Key, Paragraphs);
+    }
+    return rive::SimpleArray<rive::Paragraph>(*Paragraphs);
+}
+
+void FRiveTextShapeCache::RemoveFont(const rive::Font* InFont)
+{
+    FScopeLock Lock(&CacheCS);
+
+    TArray<FKey> Keys;
+    Cache.GetKeys(Keys);
+    for (const FKey& Key : Keys)
+    {
+        if (Key.Runs.ContainsByPredicate([InFont](const rive::TextRun& Run) {
+                return Run.font.get() == InFont;
+            }))
+        {
+            Cache.Remove(Key);
+        }
+    }
+}
+
+FRiveTextShapeCache::FKey::FKey(rive::Span<const rive::Unichar> InText,
+                                TArray<rive::TextRun>&& InRuns) :
+    Text(InText.data(), InText.size()), Runs(MoveTemp(InRuns))
+{
+    Hash = static_cast<uint32>(
+        FXxHash64::HashBuffer(Text.GetData(), Text.Num() * Text.GetTypeSize())
+            .Hash);
+    for (const rive::TextRun& Run : Runs)
+    {
+        Hash = HashCombine(Hash, PointerHash(Run.font.get()));
+        Hash = HashCombine(Hash, GetTypeHash(Run.size));
+        Hash = HashCombine(Hash, GetTypeHash(Run.lineHeight));
+        Hash = HashCombine(Hash, GetTypeHash(Run.letterSpacing));
+        Hash = HashCombine(Hash, GetTypeHash(Run.unicharCount));
+        Hash = HashCombine(Hash, GetTypeHash(Run.script));
+        Hash = HashCombine(Hash, GetTypeHash(Run.styleId));
+        Hash = HashCombine(Hash, GetTypeHash(static_cast<uint8>(Run.dir)));
+    }
+}
+
+bool FRiveTextShapeCache::FKey::operator==(const FKey& Other) const
+{
+    if (Hash != Other.Hash || Text != Other.Text ||
+        Runs.Num() != Other.Runs.Num())
+    {
+        return false;
+    }
+
+    for (int32 Index = 0; Index < Runs.Num(); ++Index)
+    {
+        const rive::TextRun& Run = Runs[Index];
+        const rive::TextRun& OtherRun = Other.Runs[Index];
+        if (Run.font != OtherRun.font || Run.size != OtherRun.size ||
+            Run.lineHeight != OtherRun.lineHeight ||
+            Run.letterSpacing != OtherRun.letterSpacing ||
+            Run.unicharCount != OtherRun.unicharCount ||
+            Run.script != OtherRun.script || Run.styleId != OtherRun.styleId ||
+            Run.dir != OtherRun.dir)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+#endif // WITH_RIVE
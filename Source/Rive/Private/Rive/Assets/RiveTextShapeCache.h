@@ -0,0 +1,80 @@
+// Copyright Rive, Inc. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/LruCache.h"
+
+#if WITH_RIVE
+
+THIRD_PARTY_INCLUDES_START
+#include "rive/text_engine.hpp"
+THIRD_PARTY_INCLUDES_END
+
+/**
+ * Paragraphs shaped for a text and its runs, shared by every artboard, so
+ * that text runs cycling through the same few values (counters, timers,
+ * localized labels) are only shaped once per value.
+ *
+ * Fonts opt in by being wrapped with WrapFont, their text then shapes through
+ * the cache. Bounded by r.rive.textshapecache.size entries, the least
+ * recently used going first, 0 disables it. Entries of a font go along with
+ * its wrapper, so that they don't keep it alive past the files using it.
+ */
+class FRiveTextShapeCache
+{
+    /**
+     * Structor(s)
+     */
+
+public:
+    static FRiveTextShapeCache& Get();
+
+private:
+    FRiveTextShapeCache();
+
+    /**
+     * Implementation(s)
+     */
+
+public:
+    /** InFont shaping its text through the cache */
+    static rive::rcp<rive::Font> WrapFont(rive::rcp<rive::Font> InFont);
+
+    /** Same as rive::Font::shapeText, shaping only on a cache miss */
+    rive::SimpleArray<rive::Paragraph> ShapeText(
+        rive::Span<const rive::Unichar> InText,
+        rive::Span<const rive::TextRun> InRuns);
+
+    /** Forgets the texts shaped with InFont, an unwrapped font */
+    void RemoveFont(const rive::Font* InFont);
+
+private:
+    struct FKey
+    {
+        FKey(rive::Span<const rive::Unichar> InText,
+             TArray<rive::TextRun>&& InRuns);
+
+        bool operator==(const FKey& Other) const;
+
+        friend uint32 GetTypeHash(const FKey& InKey) { return InKey.Hash; }
+
+        TArray<rive::Unichar> Text;
+        /** Runs with their unwrapped fonts, which they keep alive */
+        TArray<rive::TextRun> Runs;
+        uint32 Hash = 0;
+    };
+
+    using FParagraphs = TSharedPtr<const rive::SimpleArray<rive::Paragraph>,
+                                   ESPMode::ThreadSafe>;
+
+    /**
+     * Attribute(s)
+     */
+
+private:
+    FCriticalSection CacheCS;
+    TLruCache<FKey, FParagraphs> Cache;
+};
+
+#endif // WITH_RIVE
@@ -2,9 +2,11 @@
 
 #include "Rive/RiveArtboard.h"
 
+#include "Async/ParallelFor.h"
 #include "IRiveRenderer.h"
 #include "IRiveRendererModule.h"
 #include "Logs/RiveLog.h"
+#include "Rive/RiveArtboardPool.h"
 #include "Rive/RiveEvent.h"
 #include "Rive/RiveFile.h"
 #include "Rive/RiveStateMachine.h"
@@ -20,6 +22,23 @@ THIRD_PARTY_INCLUDES_START
 THIRD_PARTY_INCLUDES_END
 #endif // WITH_RIVE
 
+static TAutoConsoleVariable<int32> CVarRiveParallelAdvance(
+    TEXT("r.rive.paralleladvance"),
+    1,
+    TEXT("If non 0, artboards ticked together advance their state machines "
+         "in parallel on the task graph.\n")
+        TEXT("  0: advance on the game thread, one artboard after the other\n")
+            TEXT("  1: advance in parallel (default)"),
+    ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarRiveParallelAdvanceMinBatchSize(
+    TEXT("r.rive.paralleladvance.minbatchsize"),
+    8,
+    TEXT("Smallest number of artboards advanced by a single task when "
+         "r.rive.paralleladvance is enabled. Batches smaller than this stay "
+         "on the game thread."),
+    ECVF_Default);
+
 #if WITH_RIVE
 
 void URiveArtboard::BeginDestroy()
@@ -33,6 +52,8 @@ void URiveArtboard::AdvanceStateMachine(float InDeltaSeconds)
     if (!RiveRenderTarget)
         return;
 
+    bIsSettled = false;
+
     FRiveStateMachine* StateMachine = GetStateMachine();
     if (StateMachine && StateMachine->IsValid())
     {
@@ -42,9 +63,91 @@ void URiveArtboard::AdvanceStateMachine(float InDeltaSeconds)
             {
                 PopulateReportedEvents();
             }
-            StateMachine->Advance(InDeltaSeconds);
+            bIsSettled = !StateMachine->Advance(InDeltaSeconds);
+        }
+    }
+}
+
+void URiveArtboard::AdvanceStateMachines(
+    TConstArrayView<URiveArtboard*> InArtboards,
+    float InDeltaSeconds)
+{
+    SCOPED_NAMED_EVENT_TEXT("URiveArtboard::AdvanceStateMachines",
+                            FColor::White);
+    DECLARE_SCOPE_CYCLE_COUNTER(TEXT("RiveArtboard::AdvanceStateMachines"),
+                                STAT_RIVEARTBOARD_ADVANCESTATEMACHINES,
+                                STATGROUP_Rive);
+    check(IsInGameThread());
+
+    TArray<URiveArtboard*, TInlineAllocator<16>> AdvancedArtboards;
+    TArray<FRiveStateMachine*, TInlineAllocator<16>> StateMachines;
+    AdvancedArtboards.Reserve(InArtboards.Num());
+    StateMachines.Reserve(InArtboards.Num());
+
+    for (URiveArtboard* Artboard : InArtboards)
+    {
+        if (Artboard == nullptr || !Artboard->RiveRenderTarget ||
+            !Artboard->bIsInitialized)
+        {
+            continue;
+        }
+
+        // Custom tick delegates are user code, they stay on the game thread
+        if (Artboard->OnArtboardTick_StateMachine.IsBound())
+        {
+            Artboard->Tick_StateMachine(InDeltaSeconds);
+            continue;
+        }
+
+        Artboard->bIsSettled = false;
+
+        FRiveStateMachine* StateMachine = Artboard->GetStateMachine();
+        if (Artboard->bIsReceivingInput || StateMachine == nullptr ||
+            !StateMachine->IsValid())
+        {
+            continue;
         }
+
+        // Same order as AdvanceStateMachine: events reported by the previous
+        // advance and by input since then are broadcast before advancing
+        // again, which clears them
+        if (StateMachine->HasAnyReportedEvents())
+        {
+            Artboard->PopulateReportedEvents();
+        }
+
+        AdvancedArtboards.Add(Artboard);
+        StateMachines.Add(StateMachine);
     }
+
+    INC_DWORD_STAT_BY(STAT_RiveBatchAdvancedArtboards, StateMachines.Num());
+
+    // State machines only touch their own artboard instance, guarded by its
+    // own lock, so they can advance side by side
+    int32 MinBatchSize = 1;
+    const bool bParallel =
+        ShouldAdvanceInParallel(StateMachines.Num(), MinBatchSize);
+
+    ParallelFor(
+        TEXT("Rive.AdvanceStateMachines"),
+        StateMachines.Num(),
+        MinBatchSize,
+        [&AdvancedArtboards, &StateMachines, InDeltaSeconds](int32 Index) {
+            AdvancedArtboards[Index]->bIsSettled =
+                !StateMachines[Index]->Advance(InDeltaSeconds);
+        },
+        bParallel ? EParallelForFlags::None
+                  : EParallelForFlags::ForceSingleThread);
+}
+
+bool URiveArtboard::ShouldAdvanceInParallel(int32 InNum,
+                                            int32& OutMinBatchSize)
+{
+    OutMinBatchSize = FMath::Max(
+        1,
+        CVarRiveParallelAdvanceMinBatchSize.GetValueOnGameThread());
+    return CVarRiveParallelAdvance.GetValueOnGameThread() != 0 &&
+           InNum > OutMinBatchSize;
 }
 
 void URiveArtboard::Transform(const FVector2f& One,
@@ -82,7 +185,8 @@ void URiveArtboard::Align(const FBox2f InBox,
                             InFitType,
                             FRiveAlignment::GetAlignment(InAlignment),
                             InScaleFactor,
-                            GetNativeArtboard());
+                            GetNativeArtboard(),
+                            ArtboardCS);
 }
 
 void URiveArtboard::Align(ERiveFitType InFitType,
@@ -96,7 +200,8 @@ void URiveArtboard::Align(ERiveFitType InFitType,
     RiveRenderTarget->Align(InFitType,
                             FRiveAlignment::GetAlignment(InAlignment),
                             InScaleFactor,
-                            GetNativeArtboard());
+                            GetNativeArtboard(),
+                            ArtboardCS);
 }
 
 FMatrix URiveArtboard::GetTransformMatrix() const
@@ -114,74 +219,62 @@ void URiveArtboard::Draw()
     {
         return;
     }
-    RiveRenderTarget->Draw(GetNativeArtboard());
+    RiveRenderTarget->Draw(GetNativeArtboard(), ArtboardCS);
     LastDrawTransform = GetTransformMatrix();
 }
 
 void URiveArtboard::FireTrigger(const FString& InPropertyName) const
 {
-    IRiveRenderer* RiveRenderer = IRiveRendererModule::Get().GetRenderer();
-    if (ensure(RiveRenderer))
+    FScopeLock Lock(ArtboardCS.Get());
+    if (const FRiveStateMachine* StateMachine = GetStateMachine())
     {
-        FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
-        if (const FRiveStateMachine* StateMachine = GetStateMachine())
-        {
-            StateMachine->FireTrigger(InPropertyName);
-        }
+        StateMachine->FireTrigger(InPropertyName);
     }
 }
 
 void URiveArtboard::FireTriggerAtPath(const FString& InInputName,
                                       const FString& InPath) const
 {
-    IRiveRenderer* RiveRenderer = IRiveRendererModule::Get().GetRenderer();
-    if (ensure(RiveRenderer))
-    {
-        FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
+    FScopeLock Lock(ArtboardCS.Get());
 
-        if (!NativeArtboardPtr)
-        {
-            UE_LOG(LogRive, Warning, TEXT("Invalid Artboard Pointer."));
-            return;
-        }
-
-        rive::SMITrigger* SmiTrigger =
-            NativeArtboardPtr->getTrigger(TCHAR_TO_UTF8(*InInputName),
-                                          TCHAR_TO_UTF8(*InPath));
-        if (!SmiTrigger)
-        {
-            UE_LOG(LogRive,
-                   Warning,
-                   TEXT("Invalid input for %s at path %s"),
-                   *InInputName,
-                   *InPath);
-            return;
-        }
+    if (!NativeArtboardPtr)
+    {
+        UE_LOG(LogRive, Warning, TEXT("Invalid Artboard Pointer."));
+        return;
+    }
 
-        if (!SmiTrigger->input()->is<rive::StateMachineTriggerBase>())
-        {
-            UE_LOG(LogRive,
-                   Warning,
-                   TEXT("Input for %s at path %s is not a trigger"),
-                   *InInputName,
-                   *InPath);
-            return;
-        }
+    rive::SMITrigger* SmiTrigger =
+        NativeArtboardPtr->getTrigger(TCHAR_TO_UTF8(*InInputName),
+                                      TCHAR_TO_UTF8(*InPath));
+    if (!SmiTrigger)
+    {
+        UE_LOG(LogRive,
+               Warning,
+               TEXT("Invalid input for %s at path %s"),
+               *InInputName,
+               *InPath);
+        return;
+    }
 
-        SmiTrigger->fire();
+    if (!SmiTrigger->input()->is<rive::StateMachineTriggerBase>())
+    {
+        UE_LOG(LogRive,
+               Warning,
+               TEXT("Input for %s at path %s is not a trigger"),
+               *InInputName,
+               *InPath);
+        return;
     }
+
+    SmiTrigger->fire();
 }
 
 bool URiveArtboard::GetBoolValue(const FString& InPropertyName) const
 {
-    IRiveRenderer* RiveRenderer = IRiveRendererModule::Get().GetRenderer();
-    if (ensure(RiveRenderer))
+    FScopeLock Lock(ArtboardCS.Get());
+    if (const FRiveStateMachine* StateMachine = GetStateMachine())
     {
-        FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
-        if (const FRiveStateMachine* StateMachine = GetStateMachine())
-        {
-            return StateMachine->GetBoolValue(InPropertyName);
-        }
+        return StateMachine->GetBoolValue(InPropertyName);
     }
     return false;
 }
@@ -190,60 +283,49 @@ bool URiveArtboard::GetBoolValueAtPath(const FString& InInputName,
                                        const FString& InPath,
                                        bool& OutSuccess) const
 {
-    IRiveRenderer* RiveRenderer = IRiveRendererModule::Get().GetRenderer();
-    if (ensure(RiveRenderer))
-    {
-        FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
-
-        if (!NativeArtboardPtr)
-        {
-            UE_LOG(LogRive, Warning, TEXT("Invalid Artboard Pointer."));
-            OutSuccess = false;
-            return false;
-        }
-        rive::SMIBool* SmiBool =
-            NativeArtboardPtr->getBool(TCHAR_TO_UTF8(*InInputName),
-                                       TCHAR_TO_UTF8(*InPath));
-        if (!SmiBool)
-        {
-            UE_LOG(LogRive,
-                   Warning,
-                   TEXT("Invalid input for %s at path %s"),
-                   *InInputName,
-                   *InPath);
-            OutSuccess = false;
-            return false;
-        }
+    FScopeLock Lock(ArtboardCS.Get());
 
-        if (!SmiBool->input()->is<rive::StateMachineBoolBase>())
-        {
-            UE_LOG(LogRive,
-                   Warning,
-                   TEXT("Input for %s at path %s is not a bool"),
-                   *InInputName,
-                   *InPath);
-            OutSuccess = false;
-            return false;
-        }
+    if (!NativeArtboardPtr)
+    {
+        UE_LOG(LogRive, Warning, TEXT("Invalid Artboard Pointer."));
+        OutSuccess = false;
+        return false;
+    }
+    rive::SMIBool* SmiBool =
+        NativeArtboardPtr->getBool(TCHAR_TO_UTF8(*InInputName),
+                                   TCHAR_TO_UTF8(*InPath));
+    if (!SmiBool)
+    {
+        UE_LOG(LogRive,
+               Warning,
+               TEXT("Invalid input for %s at path %s"),
+               *InInputName,
+               *InPath);
+        OutSuccess = false;
+        return false;
+    }
 
-        OutSuccess = true;
-        return SmiBool->value();
+    if (!SmiBool->input()->is<rive::StateMachineBoolBase>())
+    {
+        UE_LOG(LogRive,
+               Warning,
+               TEXT("Input for %s at path %s is not a bool"),
+               *InInputName,
+               *InPath);
+        OutSuccess = false;
+        return false;
     }
 
-    OutSuccess = false;
-    return false;
+    OutSuccess = true;
+    return SmiBool->value();
 }
 
 float URiveArtboard::GetNumberValue(const FString& InPropertyName) const
 {
-    IRiveRenderer* RiveRenderer = IRiveRendererModule::Get().GetRenderer();
-    if (ensure(RiveRenderer))
+    FScopeLock Lock(ArtboardCS.Get());
+    if (const FRiveStateMachine* StateMachine = GetStateMachine())
     {
-        FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
-        if (const FRiveStateMachine* StateMachine = GetStateMachine())
-        {
-            return StateMachine->GetNumberValue(InPropertyName);
-        }
+        return StateMachine->GetNumberValue(InPropertyName);
     }
     return 0.f;
 }
@@ -252,65 +334,54 @@ float URiveArtboard::GetNumberValueAtPath(const FString& InInputName,
                                           const FString& InPath,
                                           bool& OutSuccess) const
 {
-    IRiveRenderer* RiveRenderer = IRiveRendererModule::Get().GetRenderer();
-    if (ensure(RiveRenderer))
-    {
-        FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
+    FScopeLock Lock(ArtboardCS.Get());
 
-        if (!NativeArtboardPtr)
-        {
-            UE_LOG(LogRive, Warning, TEXT("Invalid Artboard Pointer."));
-            OutSuccess = false;
-            return 0.f;
-        }
-
-        rive::SMINumber* SmiNumber =
-            NativeArtboardPtr->getNumber(TCHAR_TO_UTF8(*InInputName),
-                                         TCHAR_TO_UTF8(*InPath));
-        if (!SmiNumber)
-        {
-            UE_LOG(LogRive,
-                   Warning,
-                   TEXT("Invalid input for %s at path %s"),
-                   *InInputName,
-                   *InPath);
-            OutSuccess = false;
-            return 0.f;
-        }
+    if (!NativeArtboardPtr)
+    {
+        UE_LOG(LogRive, Warning, TEXT("Invalid Artboard Pointer."));
+        OutSuccess = false;
+        return 0.f;
+    }
 
-        if (!SmiNumber->input()->is<rive::StateMachineNumberBase>())
-        {
-            UE_LOG(LogRive,
-                   Warning,
-                   TEXT("Input for %s at path %s is not a number"),
-                   *InInputName,
-                   *InPath);
-            OutSuccess = false;
-            return 0.f;
-        }
+    rive::SMINumber* SmiNumber =
+        NativeArtboardPtr->getNumber(TCHAR_TO_UTF8(*InInputName),
+                                     TCHAR_TO_UTF8(*InPath));
+    if (!SmiNumber)
+    {
+        UE_LOG(LogRive,
+               Warning,
+               TEXT("Invalid input for %s at path %s"),
+               *InInputName,
+               *InPath);
+        OutSuccess = false;
+        return 0.f;
+    }
 
-        OutSuccess = true;
-        return SmiNumber->value();
+    if (!SmiNumber->input()->is<rive::StateMachineNumberBase>())
+    {
+        UE_LOG(LogRive,
+               Warning,
+               TEXT("Input for %s at path %s is not a number"),
+               *InInputName,
+               *InPath);
+        OutSuccess = false;
+        return 0.f;
     }
 
-    OutSuccess = false;
-    return 0.f;
+    OutSuccess = true;
+    return SmiNumber->value();
 }
 
 FString URiveArtboard::GetTextValue(const FString& InPropertyName) const
 {
-    IRiveRenderer* RiveRenderer = IRiveRendererModule::Get().GetRenderer();
-    if (ensure(RiveRenderer))
+    FScopeLock Lock(ArtboardCS.Get());
+    if (const FRiveStateMachine* StateMachine = GetStateMachine())
     {
-        FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
-        if (const FRiveStateMachine* StateMachine = GetStateMachine())
+        if (const rive::TextValueRunBase* TextValueRun =
+                NativeArtboardPtr->find<rive::TextValueRunBase>(
+                    TCHAR_TO_UTF8(*InPropertyName)))
         {
-            if (const rive::TextValueRunBase* TextValueRun =
-                    NativeArtboardPtr->find<rive::TextValueRunBase>(
-                        TCHAR_TO_UTF8(*InPropertyName)))
-            {
-                return FString{TextValueRun->text().c_str()};
-            }
+            return FString{TextValueRun->text().c_str()};
         }
     }
     return {};
@@ -320,50 +391,39 @@ FString URiveArtboard::GetTextValueAtPath(const FString& InInputName,
                                           const FString& InPath,
                                           bool& OutSuccess) const
 {
-    IRiveRenderer* RiveRenderer = IRiveRendererModule::Get().GetRenderer();
-    if (ensure(RiveRenderer))
-    {
-        FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
-
-        if (!NativeArtboardPtr)
-        {
-            UE_LOG(LogRive, Warning, TEXT("Invalid Artboard Pointer."));
-            OutSuccess = false;
-            return {};
-        }
+    FScopeLock Lock(ArtboardCS.Get());
 
-        rive::TextValueRunBase* TextValueRun =
-            NativeArtboardPtr->getTextRun(TCHAR_TO_UTF8(*InInputName),
-                                          TCHAR_TO_UTF8(*InPath));
-        if (!TextValueRun)
-        {
-            UE_LOG(LogRive,
-                   Warning,
-                   TEXT("Invalid input for %s at path %s"),
-                   *InInputName,
-                   *InPath);
-            OutSuccess = false;
-            return {};
-        }
+    if (!NativeArtboardPtr)
+    {
+        UE_LOG(LogRive, Warning, TEXT("Invalid Artboard Pointer."));
+        OutSuccess = false;
+        return {};
+    }
 
-        OutSuccess = true;
-        return {TextValueRun->text().c_str()};
+    rive::TextValueRunBase* TextValueRun =
+        NativeArtboardPtr->getTextRun(TCHAR_TO_UTF8(*InInputName),
+                                      TCHAR_TO_UTF8(*InPath));
+    if (!TextValueRun)
+    {
+        UE_LOG(LogRive,
+               Warning,
+               TEXT("Invalid input for %s at path %s"),
+               *InInputName,
+               *InPath);
+        OutSuccess = false;
+        return {};
     }
 
-    OutSuccess = false;
-    return {};
+    OutSuccess = true;
+    return {TextValueRun->text().c_str()};
 }
 
 void URiveArtboard::SetBoolValue(const FString& InPropertyName, bool bNewValue)
 {
-    IRiveRenderer* RiveRenderer = IRiveRendererModule::Get().GetRenderer();
-    if (ensure(RiveRenderer))
+    FScopeLock Lock(ArtboardCS.Get());
+    if (FRiveStateMachine* StateMachine = GetStateMachine())
     {
-        FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
-        if (FRiveStateMachine* StateMachine = GetStateMachine())
-        {
-            StateMachine->SetBoolValue(InPropertyName, bNewValue);
-        }
+        StateMachine->SetBoolValue(InPropertyName, bNewValue);
     }
 }
 
@@ -372,61 +432,51 @@ void URiveArtboard::SetBoolValueAtPath(const FString& InInputName,
                                        const FString& InPath,
                                        bool& OutSuccess)
 {
-    IRiveRenderer* RiveRenderer = IRiveRendererModule::Get().GetRenderer();
-    if (ensure(RiveRenderer))
-    {
-        FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
+    FScopeLock Lock(ArtboardCS.Get());
 
-        if (!NativeArtboardPtr)
-        {
-            UE_LOG(LogRive, Warning, TEXT("Invalid Artboard Pointer."));
-            OutSuccess = false;
-            return;
-        }
-
-        rive::SMIBool* SmiBool =
-            NativeArtboardPtr->getBool(TCHAR_TO_UTF8(*InInputName),
-                                       TCHAR_TO_UTF8(*InPath));
-        if (!SmiBool)
-        {
-            UE_LOG(LogRive,
-                   Warning,
-                   TEXT("Invalid input for %s at path %s"),
-                   *InInputName,
-                   *InPath);
-            OutSuccess = false;
-            return;
-        }
+    if (!NativeArtboardPtr)
+    {
+        UE_LOG(LogRive, Warning, TEXT("Invalid Artboard Pointer."));
+        OutSuccess = false;
+        return;
+    }
 
-        if (!SmiBool->input()->is<rive::StateMachineBoolBase>())
-        {
-            UE_LOG(LogRive,
-                   Warning,
-                   TEXT("Input for %s at path %s is not a bool"),
-                   *InInputName,
-                   *InPath);
-            OutSuccess = false;
-            return;
-        }
+    rive::SMIBool* SmiBool =
+        NativeArtboardPtr->getBool(TCHAR_TO_UTF8(*InInputName),
+                                   TCHAR_TO_UTF8(*InPath));
+    if (!SmiBool)
+    {
+        UE_LOG(LogRive,
+               Warning,
+               TEXT("Invalid input for %s at path %s"),
+               *InInputName,
+               *InPath);
+        OutSuccess = false;
+        return;
+    }
 
-        SmiBool->value(InValue);
-        OutSuccess = true;
+    if (!SmiBool->input()->is<rive::StateMachineBoolBase>())
+    {
+        UE_LOG(LogRive,
+               Warning,
+               TEXT("Input for %s at path %s is not a bool"),
+               *InInputName,
+               *InPath);
+        OutSuccess = false;
+        return;
     }
 
-    OutSuccess = false;
+    SmiBool->value(InValue);
+    OutSuccess = true;
 }
 
 void URiveArtboard::SetNumberValue(const FString& InPropertyName,
                                    float NewValue)
 {
-    IRiveRenderer* RiveRenderer = IRiveRendererModule::Get().GetRenderer();
-    if (ensure(RiveRenderer))
+    FScopeLock Lock(ArtboardCS.Get());
+    if (FRiveStateMachine* StateMachine = GetStateMachine())
     {
-        FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
-        if (FRiveStateMachine* StateMachine = GetStateMachine())
-        {
-            StateMachine->SetNumberValue(InPropertyName, NewValue);
-        }
+        StateMachine->SetNumberValue(InPropertyName, NewValue);
     }
 }
 
@@ -435,65 +485,55 @@ void URiveArtboard::SetNumberValueAtPath(const FString& InInputName,
                                          const FString& InPath,
                                          bool& OutSuccess)
 {
-    IRiveRenderer* RiveRenderer = IRiveRendererModule::Get().GetRenderer();
-    if (ensure(RiveRenderer))
-    {
-        FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
+    FScopeLock Lock(ArtboardCS.Get());
 
-        if (!NativeArtboardPtr)
-        {
-            UE_LOG(LogRive, Warning, TEXT("Invalid Artboard Pointer."));
-            OutSuccess = false;
-            return;
-        }
-
-        rive::SMINumber* SmiNumber =
-            NativeArtboardPtr->getNumber(TCHAR_TO_UTF8(*InInputName),
-                                         TCHAR_TO_UTF8(*InPath));
-        if (!SmiNumber)
-        {
-            UE_LOG(LogRive,
-                   Warning,
-                   TEXT("Invalid input for %s at path %s"),
-                   *InInputName,
-                   *InPath);
-            OutSuccess = false;
-            return;
-        }
+    if (!NativeArtboardPtr)
+    {
+        UE_LOG(LogRive, Warning, TEXT("Invalid Artboard Pointer."));
+        OutSuccess = false;
+        return;
+    }
 
-        if (!SmiNumber->input()->is<rive::StateMachineNumberBase>())
-        {
-            UE_LOG(LogRive,
-                   Warning,
-                   TEXT("Input for %s at path %s is not a number"),
-                   *InInputName,
-                   *InPath);
-            OutSuccess = false;
-            return;
-        }
+    rive::SMINumber* SmiNumber =
+        NativeArtboardPtr->getNumber(TCHAR_TO_UTF8(*InInputName),
+                                     TCHAR_TO_UTF8(*InPath));
+    if (!SmiNumber)
+    {
+        UE_LOG(LogRive,
+               Warning,
+               TEXT("Invalid input for %s at path %s"),
+               *InInputName,
+               *InPath);
+        OutSuccess = false;
+        return;
+    }
 
-        SmiNumber->value(InValue);
-        OutSuccess = true;
+    if (!SmiNumber->input()->is<rive::StateMachineNumberBase>())
+    {
+        UE_LOG(LogRive,
+               Warning,
+               TEXT("Input for %s at path %s is not a number"),
+               *InInputName,
+               *InPath);
+        OutSuccess = false;
+        return;
     }
 
-    OutSuccess = false;
+    SmiNumber->value(InValue);
+    OutSuccess = true;
 }
 
 void URiveArtboard::SetTextValue(const FString& InPropertyName,
                                  const FString& NewValue)
 {
-    IRiveRenderer* RiveRenderer = IRiveRendererModule::Get().GetRenderer();
-    if (ensure(RiveRenderer))
+    FScopeLock Lock(ArtboardCS.Get());
+    if (const FRiveStateMachine* StateMachine = GetStateMachine())
     {
-        FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
-        if (const FRiveStateMachine* StateMachine = GetStateMachine())
+        if (rive::TextValueRunBase* TextValueRun =
+                NativeArtboardPtr->find<rive::TextValueRunBase>(
+                    TCHAR_TO_UTF8(*InPropertyName)))
         {
-            if (rive::TextValueRunBase* TextValueRun =
-                    NativeArtboardPtr->find<rive::TextValueRunBase>(
-                        TCHAR_TO_UTF8(*InPropertyName)))
-            {
-                TextValueRun->text(TCHAR_TO_UTF8(*NewValue));
-            }
+            TextValueRun->text(TCHAR_TO_UTF8(*NewValue));
         }
     }
 }
@@ -503,37 +543,31 @@ void URiveArtboard::SetTextValueAtPath(const FString& InInputName,
                                        const FString& InPath,
                                        bool& OutSuccess)
 {
-    IRiveRenderer* RiveRenderer = IRiveRendererModule::Get().GetRenderer();
-    if (ensure(RiveRenderer))
-    {
-        FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
-
-        if (!NativeArtboardPtr)
-        {
-            UE_LOG(LogRive, Warning, TEXT("Invalid Artboard Pointer."));
-            OutSuccess = false;
-            return;
-        }
+    FScopeLock Lock(ArtboardCS.Get());
 
-        rive::TextValueRunBase* TextValueRun =
-            NativeArtboardPtr->getTextRun(TCHAR_TO_UTF8(*InInputName),
-                                          TCHAR_TO_UTF8(*InPath));
-        if (!TextValueRun)
-        {
-            UE_LOG(LogRive,
-                   Warning,
-                   TEXT("Invalid input for %s at path %s"),
-                   *InInputName,
-                   *InPath);
-            OutSuccess = false;
-            return;
-        }
+    if (!NativeArtboardPtr)
+    {
+        UE_LOG(LogRive, Warning, TEXT("Invalid Artboard Pointer."));
+        OutSuccess = false;
+        return;
+    }
 
-        TextValueRun->text(TCHAR_TO_UTF8(*InValue));
-        OutSuccess = true;
+    rive::TextValueRunBase* TextValueRun =
+        NativeArtboardPtr->getTextRun(TCHAR_TO_UTF8(*InInputName),
+                                      TCHAR_TO_UTF8(*InPath));
+    if (!TextValueRun)
+    {
+        UE_LOG(LogRive,
+               Warning,
+               TEXT("Invalid input for %s at path %s"),
+               *InInputName,
+               *InPath);
+        OutSuccess = false;
+        return;
     }
 
-    OutSuccess = false;
+    TextValueRun->text(TCHAR_TO_UTF8(*InValue));
+    OutSuccess = true;
 }
 
 bool URiveArtboard::BindNamedRiveEvent(const FString& EventName,
@@ -722,7 +756,7 @@ void URiveArtboard::Initialize(URiveFile* InRiveFile,
         return;
     }
 
-    FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
+    FScopeLock Lock(ArtboardCS.Get());
 
     if (!RiveFile.IsValid() || !RiveFile->GetNativeFile())
     {
@@ -785,7 +819,7 @@ void URiveArtboard::Initialize(URiveFile* InRiveFile,
         return;
     }
 
-    FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
+    FScopeLock Lock(ArtboardCS.Get());
 
     if (!RiveFile.IsValid() || !RiveFile->GetNativeFile())
     {
@@ -861,8 +895,10 @@ void URiveArtboard::SetStateMachineName(const FString& NewStateMachineName)
     {
         StateMachineName = NewStateMachineName;
 
+        FScopeLock Lock(ArtboardCS.Get());
         StateMachinePtr = MakeUnique<FRiveStateMachine>(NativeArtboardPtr.get(),
-                                                        StateMachineName);
+                                                        StateMachineName,
+                                                        ArtboardCS);
     }
 }
 
@@ -885,14 +921,24 @@ void URiveArtboard::SetAudioEngine(URiveAudioEngine* AudioEngine)
 
 void URiveArtboard::Tick_Render(float InDeltaSeconds)
 {
+    if (!RiveRenderTarget || !bIsInitialized)
+    {
+        return;
+    }
+
     SCOPED_NAMED_EVENT_TEXT("URiveArtboard::Tick_Render", FColor::White);
     DECLARE_SCOPE_CYCLE_COUNTER(TEXT("RiveArtboard::Tick_Render"),
                                 STAT_RIVEARTBOARD_TICKRENDER,
                                 STATGROUP_Rive);
+    // A render bound by the user replaces the one of our owner
     if (OnArtboardTick_Render.IsBound())
     {
         OnArtboardTick_Render.Execute(InDeltaSeconds, this);
     }
+    else if (OnArtboardTick_RenderNative.IsBound())
+    {
+        OnArtboardTick_RenderNative.Execute(InDeltaSeconds, this);
+    }
     else
     {
         Draw();
@@ -920,14 +966,19 @@ void URiveArtboard::Deinitialize()
     if (this == nullptr)
         return;
     bIsInitialized = false;
+    bIsSettled = false;
 
-    StateMachinePtr.Reset();
-    if (NativeArtboardPtr != nullptr)
     {
-        NativeArtboardPtr.release();
+        FScopeLock Lock(ArtboardCS.Get());
+        StateMachinePtr.Reset();
+        if (NativeArtboardPtr != nullptr)
+        {
+            NativeArtboardPtr.release();
+        }
+        NativeArtboardPtr.reset();
     }
-    NativeArtboardPtr.reset();
     OnArtboardTick_Render.Clear();
+    OnArtboardTick_RenderNative.Unbind();
     OnArtboardTick_StateMachine.Clear();
 }
 
@@ -944,17 +995,7 @@ void URiveArtboard::Tick(float InDeltaSeconds)
 
 rive::ArtboardInstance* URiveArtboard::GetNativeArtboard() const
 {
-    IRiveRenderer* RiveRenderer = IRiveRendererModule::Get().GetRenderer();
-    if (!RiveRenderer)
-    {
-        UE_LOG(LogRive,
-               Error,
-               TEXT("Failed to retrieve the NativeArtboard as we do not have a "
-                    "valid renderer."));
-        return nullptr;
-    }
-
-    FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
+    FScopeLock Lock(ArtboardCS.Get());
 
     if (!NativeArtboardPtr)
     {
@@ -971,17 +1012,7 @@ rive::ArtboardInstance* URiveArtboard::GetNativeArtboard() const
 
 rive::AABB URiveArtboard::GetBounds() const
 {
-    IRiveRenderer* RiveRenderer = IRiveRendererModule::Get().GetRenderer();
-    if (!RiveRenderer)
-    {
-        UE_LOG(LogRive,
-               Error,
-               TEXT("Failed to GetBounds for the Artboard as we do not have a "
-                    "valid renderer."));
-        return {};
-    }
-
-    FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
+    FScopeLock Lock(ArtboardCS.Get());
 
     if (!NativeArtboardPtr)
     {
@@ -1007,17 +1038,7 @@ FVector2f URiveArtboard::GetOriginalSize() const
 
 FVector2f URiveArtboard::GetSize() const
 {
-    IRiveRenderer* RiveRenderer = IRiveRendererModule::Get().GetRenderer();
-    if (!RiveRenderer)
-    {
-        UE_LOG(LogRive,
-               Error,
-               TEXT("Failed to GetSize for the Artboard as we do not have a "
-                    "valid renderer."));
-        return {};
-    }
-
-    FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
+    FScopeLock Lock(ArtboardCS.Get());
 
     if (!NativeArtboardPtr)
     {
@@ -1034,17 +1055,7 @@ FVector2f URiveArtboard::GetSize() const
 
 void URiveArtboard::SetSize(FVector2f InVector)
 {
-    IRiveRenderer* RiveRenderer = IRiveRendererModule::Get().GetRenderer();
-    if (!RiveRenderer)
-    {
-        UE_LOG(LogRive,
-               Error,
-               TEXT("Failed to SetSize for the Artboard as we do not have a "
-                    "valid renderer."));
-        return;
-    }
-
-    FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
+    FScopeLock Lock(ArtboardCS.Get());
 
     if (!NativeArtboardPtr)
     {
@@ -1064,17 +1075,7 @@ void URiveArtboard::SetSize(FVector2f InVector)
 
 FRiveStateMachine* URiveArtboard::GetStateMachine() const
 {
-    IRiveRenderer* RiveRenderer = IRiveRendererModule::Get().GetRenderer();
-    if (!RiveRenderer)
-    {
-        UE_LOG(LogRive,
-               Error,
-               TEXT("Failed to GetStateMachine for the Artboard as we do not "
-                    "have a valid renderer."));
-        return nullptr;
-    }
-
-    FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
+    FScopeLock Lock(ArtboardCS.Get());
 
     if (!StateMachinePtr)
     {
@@ -1092,23 +1093,36 @@ void URiveArtboard::PopulateReportedEvents()
 
     if (const FRiveStateMachine* StateMachine = GetStateMachine())
     {
-        const int32 NumReportedEvents = StateMachine->GetReportedEventsCount();
-        TickRiveReportedEvents.Reserve(NumReportedEvents);
-
-        for (int32 EventIndex = 0; EventIndex < NumReportedEvents; EventIndex++)
         {
-            const rive::EventReport ReportedEvent =
-                StateMachine->GetReportedEvent(EventIndex);
-            if (ReportedEvent.event() != nullptr)
+            // Events are copied out under the artboard lock, but broadcast
+            // without it: listeners may load files or textures, which takes
+            // the renderer lock and must never nest inside an artboard lock
+            FScopeLock Lock(ArtboardCS.Get());
+
+            const int32 NumReportedEvents =
+                StateMachine->GetReportedEventsCount();
+            TickRiveReportedEvents.Reserve(NumReportedEvents);
+
+            for (int32 EventIndex = 0; EventIndex < NumReportedEvents;
+                 EventIndex++)
             {
-                FRiveEvent RiveEvent;
-                RiveEvent.Initialize(ReportedEvent);
-                if (const FRiveNamedEventsDelegate* NamedEventDelegate =
-                        NamedRiveEventsDelegates.Find(RiveEvent.Name))
+                const rive::EventReport ReportedEvent =
+                    StateMachine->GetReportedEvent(EventIndex);
+                if (ReportedEvent.event() != nullptr)
                 {
-                    NamedEventDelegate->Broadcast(this, RiveEvent);
+                    FRiveEvent& RiveEvent =
+                        TickRiveReportedEvents.AddDefaulted_GetRef();
+                    RiveEvent.Initialize(ReportedEvent);
                 }
-                TickRiveReportedEvents.Add(MoveTemp(RiveEvent));
+            }
+        }
+
+        for (const FRiveEvent& RiveEvent : TickRiveReportedEvents)
+        {
+            if (const FRiveNamedEventsDelegate* NamedEventDelegate =
+                    NamedRiveEventsDelegates.Find(RiveEvent.Name))
+            {
+                NamedEventDelegate->Broadcast(this, RiveEvent);
             }
         }
 
@@ -1141,32 +1155,33 @@ void URiveArtboard::Initialize_Internal(const rive::Artboard* InNativeArtboard)
         return;
     }
 
-    ArtboardName = FString{NativeArtboardPtr->name().c_str()};
     NativeArtboardPtr->advance(0);
 
-    // UI Helpers
-    StateMachineNames.Empty();
-    for (int i = 0; i < NativeArtboardPtr->stateMachineCount(); ++i)
+    // Names are gathered once per native artboard by the file, we only keep a
+    // copy for Blueprints and the editor
+    if (const TSharedPtr<const FRiveArtboardMetadata> Metadata =
+            RiveFile.IsValid()
+                ? RiveFile->GetArtboardMetadata(InNativeArtboard)
+                : nullptr)
+    {
+        ArtboardName = Metadata->ArtboardName;
+        StateMachineNames = Metadata->StateMachineNames;
+        EventNames = Metadata->EventNames;
+    }
+    else
     {
-        const rive::StateMachine* NativeStateMachine =
-            NativeArtboardPtr->stateMachine(i);
-        StateMachineNames.Add(NativeStateMachine->name().c_str());
+        ArtboardName = FString{NativeArtboardPtr->name().c_str()};
+        StateMachineNames.Empty();
+        EventNames.Empty();
     }
 
     StateMachinePtr = MakeUnique<FRiveStateMachine>(NativeArtboardPtr.get(),
-                                                    StateMachineName);
+                                                    StateMachineName,
+                                                    ArtboardCS);
 
     // Update our active StateMachineNAme with our actual state machine name
     StateMachineName = StateMachinePtr->GetStateMachineName();
 
-    EventNames.Empty();
-    const std::vector<rive::Event*> Events =
-        NativeArtboardPtr->find<rive::Event>();
-    for (const rive::Event* Event : Events)
-    {
-        EventNames.Add(Event->name().c_str());
-    }
-
     bIsInitialized = true;
 }
 
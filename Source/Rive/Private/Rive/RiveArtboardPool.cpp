@@ -0,0 +1,239 @@
+// Copyright Rive, Inc. All rights reserved.
+
+#include "Rive/RiveArtboardPool.h"
+
+#include "Async/ParallelFor.h"
+#include "IRiveRenderer.h"
+#include "IRiveRendererModule.h"
+#include "Logs/RiveLog.h"
+#include "RenderingThread.h"
+#include "Rive/RiveArtboard.h"
+#include "Rive/RiveFile.h"
+#include "Rive/RiveStateMachine.h"
+#include "Stats/RiveStats.h"
+
+FRiveArtboardPool::FRiveArtboardPool(URiveFile* InRiveFile) :
+    RiveFile(InRiveFile)
+{
+    if (InRiveFile != nullptr)
+    {
+        FileInitializingHandle =
+            InRiveFile->OnStartInitializingDelegate.AddRaw(
+                this,
+                &FRiveArtboardPool::OnFileStartInitializing);
+    }
+}
+
+FRiveArtboardPool::~FRiveArtboardPool()
+{
+    if (URiveFile* File = RiveFile.Get())
+    {
+        File->OnStartInitializingDelegate.Remove(FileInitializingHandle);
+    }
+    Reset();
+}
+
+FRiveArtboardHandle FRiveArtboardPool::Create(
+    const FString& InArtboardName,
+    const FString& InStateMachineName)
+{
+    SCOPE_CYCLE_COUNTER(STAT_RiveArtboardPoolCreate);
+    check(IsInGameThread());
+
+    URiveFile* File = RiveFile.Get();
+    if (File == nullptr || !File->IsInitialized() || !File->GetNativeFile())
+    {
+        UE_LOG(LogRive,
+               Error,
+               TEXT("Can't instantiate an artboard without a valid and "
+                    "initialized RiveFile."));
+        return {};
+    }
+
+    rive::File* NativeFile = File->GetNativeFile();
+    rive::Artboard* NativeArtboard =
+        InArtboardName.IsEmpty()
+            ? NativeFile->artboard()
+            : NativeFile->artboard(TCHAR_TO_UTF8(*InArtboardName));
+    if (NativeArtboard == nullptr && !InArtboardName.IsEmpty())
+    {
+        UE_LOG(LogRive,
+               Warning,
+               TEXT("Could not initialize the artboard by the name '%s'. "
+                    "Initializing with default artboard instead"),
+               *InArtboardName);
+        NativeArtboard = NativeFile->artboard();
+    }
+    if (NativeArtboard == nullptr)
+    {
+        return {};
+    }
+
+    std::unique_ptr<rive::ArtboardInstance> NativeInstance =
+        NativeArtboard->instance();
+    if (!NativeInstance)
+    {
+        return {};
+    }
+    NativeInstance->advance(0);
+
+    int32 Index;
+    if (!FreeIndices.IsEmpty())
+    {
+        Index = FreeIndices.Pop();
+    }
+    else
+    {
+        Index = Instances.AddDefaulted();
+    }
+
+    FInstance& Instance = Instances[Index];
+    Instance.ArtboardCS = MakeShared<FCriticalSection, ESPMode::ThreadSafe>();
+    Instance.StateMachine = MakeUnique<FRiveStateMachine>(NativeInstance.get(),
+                                                          InStateMachineName,
+                                                          Instance.ArtboardCS);
+    Instance.NativeArtboard = std::move(NativeInstance);
+    Instance.Metadata = File->GetArtboardMetadata(NativeArtboard);
+    Instance.bIsSettled = false;
+    INC_DWORD_STAT(STAT_RivePooledArtboards);
+
+    return {Index, Instance.Generation};
+}
+
+void FRiveArtboardPool::Release(const FRiveArtboardHandle& InHandle)
+{
+    check(IsInGameThread());
+
+    if (!IsValid(InHandle))
+    {
+        return;
+    }
+
+    FInstance& Instance = Instances[InHandle.Index];
+
+    // Draws recorded before now may still wait in the render scheduler for
+    // the end of the frame, send them first so that they are enqueued ahead
+    // of the release
+    if (IRiveRendererModule::IsAvailable())
+    {
+        if (IRiveRenderer* RiveRenderer =
+                IRiveRendererModule::Get().GetRenderer())
+        {
+            RiveRenderer->FlushPendingRenderTargets_GameThread();
+        }
+    }
+
+    // Those draws still read the instance on the rendering thread, it goes
+    // away after them. The state machine goes first, it points into the
+    // artboard.
+    ENQUEUE_RENDER_COMMAND(FRiveArtboardPoolRelease)
+    ([StateMachine = MoveTemp(Instance.StateMachine),
+      NativeArtboard = std::move(Instance.NativeArtboard),
+      ArtboardCS = MoveTemp(Instance.ArtboardCS)](
+         FRHICommandListImmediate&) mutable {
+        FScopeLock Lock(ArtboardCS.Get());
+        StateMachine.Reset();
+        NativeArtboard.reset();
+    });
+    Instance.Metadata.Reset();
+    ++Instance.Generation;
+    FreeIndices.Add(InHandle.Index);
+    DEC_DWORD_STAT(STAT_RivePooledArtboards);
+}
+
+void FRiveArtboardPool::Reset()
+{
+    for (int32 Index = 0; Index < Instances.Num(); ++Index)
+    {
+        Release({Index, Instances[Index].Generation});
+    }
+}
+
+void FRiveArtboardPool::OnFileStartInitializing()
+{
+    Reset();
+
+    // The native file our instances come from is about to be replaced
+    FlushRenderingCommands();
+}
+
+rive::ArtboardInstance* FRiveArtboardPool::GetNativeArtboard(
+    const FRiveArtboardHandle& InHandle) const
+{
+    const FInstance* Instance = Find(InHandle);
+    return Instance ? Instance->NativeArtboard.get() : nullptr;
+}
+
+FRiveStateMachine* FRiveArtboardPool::GetStateMachine(
+    const FRiveArtboardHandle& InHandle) const
+{
+    const FInstance* Instance = Find(InHandle);
+    return Instance ? Instance->StateMachine.Get() : nullptr;
+}
+
+const FRiveArtboardMetadata* FRiveArtboardPool::GetMetadata(
+    const FRiveArtboardHandle& InHandle) const
+{
+    const FInstance* Instance = Find(InHandle);
+    return Instance ? Instance->Metadata.Get() : nullptr;
+}
+
+bool FRiveArtboardPool::IsSettled(const FRiveArtboardHandle& InHandle) const
+{
+    const FInstance* Instance = Find(InHandle);
+    return Instance && Instance->bIsSettled;
+}
+
+void FRiveArtboardPool::AdvanceAll(float InDeltaSeconds)
+{
+    SCOPED_NAMED_EVENT_TEXT("FRiveArtboardPool::AdvanceAll", FColor::White);
+    DECLARE_SCOPE_CYCLE_COUNTER(TEXT("RiveArtboardPool::AdvanceAll"),
+                                STAT_RIVEARTBOARDPOOL_ADVANCEALL,
+                                STATGROUP_Rive);
+    check(IsInGameThread());
+
+    INC_DWORD_STAT_BY(STAT_RiveBatchAdvancedArtboards, Num());
+
+    // Free entries are skipped in place, instances stay where they are so
+    // that the batches walk contiguous memory
+    int32 MinBatchSize = 1;
+    const bool bParallel =
+        URiveArtboard::ShouldAdvanceInParallel(Num(), MinBatchSize);
+
+    ParallelFor(
+        TEXT("Rive.ArtboardPool.AdvanceAll"),
+        Instances.Num(),
+        MinBatchSize,
+        [this, InDeltaSeconds](int32 Index) {
+            FInstance& Instance = Instances[Index];
+            if (Instance.StateMachine && Instance.StateMachine->IsValid())
+            {
+                Instance.bIsSettled =
+                    !Instance.StateMachine->Advance(InDeltaSeconds);
+            }
+        },
+        bParallel ? EParallelForFlags::None
+                  : EParallelForFlags::ForceSingleThread);
+}
+
+void FRiveArtboardPool::Draw(const FRiveArtboardHandle& InHandle,
+                             IRiveRenderTarget& InRenderTarget,
+                             const FBox2f& InBox,
+                             ERiveFitType InFitType,
+                             ERiveAlignment InAlignment,
+                             float InScaleFactor) const
+{
+    const FInstance* Instance = Find(InHandle);
+    if (Instance == nullptr)
+    {
+        return;
+    }
+
+    InRenderTarget.Align(InBox,
+                         InFitType,
+                         FRiveAlignment::GetAlignment(InAlignment),
+                         InScaleFactor,
+                         Instance->NativeArtboard.get(),
+                         Instance->ArtboardCS);
+    InRenderTarget.Draw(Instance->NativeArtboard.get(), Instance->ArtboardCS);
+}
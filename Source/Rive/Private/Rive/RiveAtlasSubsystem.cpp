@@ -0,0 +1,120 @@
+// Copyright Rive, Inc. All rights reserved.
+
+#include "Rive/RiveAtlasSubsystem.h"
+
+#include "Engine/Engine.h"
+#include "IRiveRenderer.h"
+#include "IRiveRendererModule.h"
+#include "Logs/RiveLog.h"
+#include "Rive/RiveTextureAtlas.h"
+#include "Stats/RiveStats.h"
+
+URiveAtlasSubsystem* URiveAtlasSubsystem::Get()
+{
+    return GEngine ? GEngine->GetEngineSubsystem<URiveAtlasSubsystem>()
+                   : nullptr;
+}
+
+void URiveAtlasSubsystem::Deinitialize()
+{
+    Pages.Empty();
+    UpdateStats();
+
+    Super::Deinitialize();
+}
+
+URiveTextureAtlas* URiveAtlasSubsystem::AcquireSlot(
+    URiveTextureObject* InOwner,
+    const FIntPoint& InSize,
+    URiveTextureAtlas* InCurrentAtlas)
+{
+    const FIntPoint SlotSize(FMath::Max(InSize.X, RIVE_MIN_TEX_RESOLUTION),
+                             FMath::Max(InSize.Y, RIVE_MIN_TEX_RESOLUTION));
+    const int32 MaxSlotSize = URiveTextureAtlas::GetMaxSlotSize();
+
+    if (SlotSize.X > MaxSlotSize || SlotSize.Y > MaxSlotSize)
+    {
+        ReleaseSlot(InOwner, InCurrentAtlas);
+        return nullptr;
+    }
+
+    if (InCurrentAtlas)
+    {
+        if (InCurrentAtlas->ResizeSlot(InOwner, SlotSize))
+        {
+            UpdateStats();
+            return InCurrentAtlas;
+        }
+
+        ReleaseSlot(InOwner, InCurrentAtlas);
+    }
+
+    for (URiveTextureAtlas* Page : Pages)
+    {
+        if (Page->AddSlot(InOwner, SlotSize))
+        {
+            UpdateStats();
+            return Page;
+        }
+    }
+
+    IRiveRenderer* RiveRenderer = IRiveRendererModule::IsAvailable()
+                                      ? IRiveRendererModule::Get().GetRenderer()
+                                      : nullptr;
+    if (!RiveRenderer)
+    {
+        UE_LOG(LogRive,
+               Error,
+               TEXT("Unable to create a Rive atlas page as we do not have a "
+                    "valid renderer."));
+        return nullptr;
+    }
+
+    URiveTextureAtlas* NewPage = NewObject<URiveTextureAtlas>(this);
+    NewPage->Initialize(RiveRenderer);
+    Pages.Add(NewPage);
+
+    if (!NewPage->AddSlot(InOwner, SlotSize))
+    {
+        UE_LOG(LogRive,
+               Warning,
+               TEXT("Slot of size %dx%d does not fit in an empty Rive atlas "
+                    "page, check r.rive.atlas.pagesize."),
+               SlotSize.X,
+               SlotSize.Y);
+        ReleaseSlot(InOwner, NewPage);
+        return nullptr;
+    }
+
+    UpdateStats();
+    return NewPage;
+}
+
+void URiveAtlasSubsystem::ReleaseSlot(URiveTextureObject* InOwner,
+                                      URiveTextureAtlas* InAtlas)
+{
+    if (!InAtlas)
+    {
+        return;
+    }
+
+    InAtlas->RemoveSlot(InOwner);
+
+    // Empty pages are dropped so their render targets can be collected
+    if (!InAtlas->HasSlots())
+    {
+        Pages.Remove(InAtlas);
+    }
+
+    UpdateStats();
+}
+
+void URiveAtlasSubsystem::UpdateStats() const
+{
+#if STATS
+    const int64 PageSize = URiveTextureAtlas::GetPageSize();
+    SET_DWORD_STAT(STAT_RiveAtlasPages, Pages.Num());
+    SET_MEMORY_STAT(STAT_RiveAtlasMemory,
+                    Pages.Num() * PageSize * PageSize * 4);
+#endif // STATS
+}
@@ -2,10 +2,6 @@
 
 #include "Rive/RiveEvent.h"
 
-#include "IRiveRenderer.h"
-#include "IRiveRendererModule.h"
-#include "Logs/RiveLog.h"
-
 #if WITH_RIVE
 THIRD_PARTY_INCLUDES_START
 #include "rive/custom_property_boolean.hpp"
@@ -19,18 +15,7 @@ THIRD_PARTY_INCLUDES_END
 
 void FRiveEvent::Initialize(const rive::EventReport& InEventReport)
 {
-    IRiveRenderer* RiveRenderer = IRiveRendererModule::Get().GetRenderer();
-    if (!RiveRenderer)
-    {
-        UE_LOG(LogRive,
-               Error,
-               TEXT("Failed to Initialize the RiveEvent as we do not have a "
-                    "valid renderer."));
-        return;
-    }
-
-    FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
-
+    // The caller holds the lock of the artboard reporting this event
     DelayInSeconds = InEventReport.secondsDelay();
 
     RiveEventBoolProperties.Reset();
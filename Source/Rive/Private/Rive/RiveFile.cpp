@@ -4,10 +4,19 @@
 #include "IRiveRenderer.h"
 #include "IRiveRendererModule.h"
 #include "Logs/RiveLog.h"
+#include "Rive/Assets/RiveAssetCache.h"
+#include "Rive/Assets/RiveAssetHelpers.h"
 #include "Rive/Assets/RiveFileAssetImporter.h"
 #include "Rive/Assets/RiveFileAssetLoader.h"
 #include "Rive/RiveArtboard.h"
+#include "Rive/RiveArtboardPool.h"
+#include "Rive/RiveTexture.h"
 #include "Blueprint/UserWidget.h"
+#include "Containers/Queue.h"
+#include "Containers/Ticker.h"
+#include "Serialization/CustomVersion.h"
+#include "UObject/ObjectSaveContext.h"
+#include "Stats/RiveStats.h"
 
 #if WITH_EDITOR
 #include "EditorFramework/AssetImportData.h"
@@ -15,7 +24,12 @@
 
 #if WITH_RIVE
 THIRD_PARTY_INCLUDES_START
+#include "rive/animation/state_machine.hpp"
+#include "rive/animation/state_machine_bool.hpp"
 #include "rive/animation/state_machine_input.hpp"
+#include "rive/animation/state_machine_number.hpp"
+#include "rive/animation/state_machine_trigger.hpp"
+#include "rive/event.hpp"
 #include "rive/renderer/render_context.hpp"
 THIRD_PARTY_INCLUDES_END
 #endif // WITH_RIVE
@@ -23,18 +37,328 @@ THIRD_PARTY_INCLUDES_END
 class FRiveFileAssetImporter;
 class FRiveFileAssetLoader;
 
+static TAutoConsoleVariable<int32> CVarRiveAsyncImport(
+    TEXT("r.rive.asyncimport"),
+    1,
+    TEXT("If non 0, Rive files import on a worker thread and finish "
+         "initializing on the game thread. Editor imports stay synchronous."),
+    ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarRiveAsyncImportBudgetMs(
+    TEXT("r.rive.asyncimport.budgetms"),
+    2.f,
+    TEXT("Milliseconds per frame the game thread spends finishing the "
+         "initialization of Rive files imported on worker threads. At least "
+         "one file finishes every frame."),
+    ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarRiveFileMemoryMap(
+    TEXT("r.rive.file.memorymap"),
+    1,
+    TEXT("If non 0, the data of cooked Rive files saved uncompressed and with "
+         "bMemoryMapPayload is memory mapped from its container when the "
+         "platform allows it, instead of read into memory."),
+    ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarRiveCookStripAssets(
+    TEXT("r.rive.cook.stripassets"),
+    1,
+    TEXT("If non 0, cooking a Rive file strips the in-band bytes of the assets "
+         "it also has out of band bytes for, which are the ones loaded."),
+    ECVF_Default);
+
+namespace UE::Private::RiveFile
+{
+struct FRiveFileCustomVersion
+{
+    enum Type
+    {
+        BeforeCustomVersionWasAdded = 0,
+        // File data moved from an inline array to bulk data
+        BulkDataPayload,
+
+        VersionPlusOne,
+        LatestVersion = VersionPlusOne - 1
+    };
+
+    inline static const FGuid GUID =
+        FGuid(0x629CED96, 0x2CE34EAD, 0xA669DB86, 0xD163301B);
+};
+
+static FCustomVersionRegistration GRegisterRiveFileCustomVersion(
+    FRiveFileCustomVersion::GUID,
+    FRiveFileCustomVersion::LatestVersion,
+    TEXT("RiveFileVer"));
+} // namespace UE::Private::RiveFile
+
+#if WITH_RIVE
+
+namespace UE::Private::RiveFile
+{
+/** Imports the bytes, on any thread */
+std::unique_ptr<rive::File> ImportNativeFile(
+    IRiveRenderer* InRiveRenderer,
+    rive::Span<const uint8> InFileSpan,
+    rive::FileAssetLoader* InAssetLoader)
+{
+    SCOPE_CYCLE_COUNTER(STAT_RiveFileImport);
+
+    // The render context is our factory. Parsing doesn't need the lock the
+    // rendering thread draws with, only creating GPU resources does, which
+    // our asset loader's hand overs lock for themselves.
+    rive::gpu::RenderContext* RenderContext;
+    {
+        FScopeLock Lock(&InRiveRenderer->GetThreadDataCS());
+        RenderContext = InRiveRenderer->GetRenderContext();
+    }
+    if (RenderContext == nullptr)
+    {
+        return nullptr;
+    }
+
+    rive::ImportResult ImportResult;
+    std::unique_ptr<rive::File> NativeFile = rive::File::import(InFileSpan,
+                                                                RenderContext,
+                                                                &ImportResult,
+                                                                InAssetLoader);
+    if (ImportResult != rive::ImportResult::success)
+    {
+        return nullptr;
+    }
+    return NativeFile;
+}
+
+/** Imports the bytes and the assets they use, on any thread */
+std::unique_ptr<rive::File> LoadNativeFile(
+    IRiveRenderer* InRiveRenderer,
+    rive::Span<const uint8> InFileSpan,
+    FRiveFileAssetLoader& InAssetLoader)
+{
+    std::unique_ptr<rive::File> NativeFile =
+        ImportNativeFile(InRiveRenderer, InFileSpan, &InAssetLoader);
+    InAssetLoader.FinishDecoding(NativeFile != nullptr);
+    return NativeFile;
+}
+
+/**
+ * Completions of the imports finished on worker threads, run on the game
+ * thread within r.rive.asyncimport.budgetms per frame so that many files
+ * streamed in together spread over several frames
+ */
+class FImportCompletionQueue
+{
+public:
+    /** Game thread only, for the ticker to be registered there */
+    static FImportCompletionQueue& Get()
+    {
+        check(IsInGameThread());
+        static FImportCompletionQueue Queue;
+        return Queue;
+    }
+
+    /** Any thread */
+    void Enqueue(TUniqueFunction<void()>&& InCompletion)
+    {
+        Completions.Enqueue(MoveTemp(InCompletion));
+        INC_DWORD_STAT(STAT_RivePendingImportCompletions);
+    }
+
+private:
+    FImportCompletionQueue()
+    {
+        FTSTicker::GetCoreTicker().AddTicker(
+            FTickerDelegate::CreateRaw(this, &FImportCompletionQueue::Tick));
+    }
+
+    bool Tick(float InDeltaSeconds)
+    {
+        const double BudgetSeconds =
+            FMath::Max(CVarRiveAsyncImportBudgetMs.GetValueOnGameThread(),
+                       0.f) /
+            1000.0;
+        const double StartTime = FPlatformTime::Seconds();
+
+        TUniqueFunction<void()> Completion;
+        while (Completions.Dequeue(Completion))
+        {
+            DEC_DWORD_STAT(STAT_RivePendingImportCompletions);
+            Completion();
+            if (FPlatformTime::Seconds() - StartTime >= BudgetSeconds)
+            {
+                break;
+            }
+        }
+        return true;
+    }
+
+    TQueue<TUniqueFunction<void()>, EQueueMode::Mpsc> Completions;
+};
+} // namespace UE::Private::RiveFile
+
+#endif // WITH_RIVE
+
 void URiveFile::BeginDestroy()
 {
     InitState = ERiveInitState::Deinitializing;
+    ArtboardMetadata.Empty();
     RiveNativeFileSpan = {};
     RiveNativeFilePtr.reset();
+#if WITH_RIVE
+    // Shared images and fonts only we used can go now
+    FRiveAssetCache::Get().Trim();
+#endif // WITH_RIVE
     UObject::BeginDestroy();
 }
 
+bool URiveFile::IsReadyForFinishDestroy()
+{
+    return ImportTask.IsCompleted() && UObject::IsReadyForFinishDestroy();
+}
+
+void URiveFile::Serialize(FArchive& Ar)
+{
+    using UE::Private::RiveFile::FRiveFileCustomVersion;
+
+    Ar.UsingCustomVersion(FRiveFileCustomVersion::GUID);
+    UObject::Serialize(Ar);
+
+    // Older assets come with RiveFileData_DEPRECATED, moved over in PostLoad
+    if (Ar.IsLoading() && Ar.CustomVer(FRiveFileCustomVersion::GUID) <
+                              FRiveFileCustomVersion::BulkDataPayload)
+    {
+        return;
+    }
+
+    FByteBulkData* FileBulkData = &RiveFileBulkData;
+
+#if WITH_EDITORONLY_DATA
+    if (Ar.IsSaving() && !Ar.IsTransacting())
+    {
+        if (Ar.IsCooking() && StrippedFileBulkData.GetBulkDataSize() > 0)
+        {
+            FileBulkData = &StrippedFileBulkData;
+        }
+
+        // Keeping the data out of the export spares loading our package from
+        // reading it
+        uint32 BulkDataFlags = BULKDATA_Force_NOT_InlinePayload;
+        if (!bCompressPayload && bMemoryMapPayload)
+        {
+            BulkDataFlags |= BULKDATA_MemoryMappedPayload;
+        }
+        FileBulkData->ResetBulkDataFlags(BulkDataFlags);
+        FileBulkData->StoreCompressedOnDisk(bCompressPayload ? NAME_Oodle
+                                                             : NAME_None);
+    }
+#endif // WITH_EDITORONLY_DATA
+
+    // Mapping only happens for data saved with BULKDATA_MemoryMappedPayload
+    const bool bAttemptFileMapping =
+        Ar.IsLoading() && CVarRiveFileMemoryMap.GetValueOnAnyThread() != 0;
+    FileBulkData->Serialize(Ar, this, INDEX_NONE, bAttemptFileMapping);
+}
+
+#if WITH_EDITOR
+void URiveFile::PreSave(FObjectPreSaveContext ObjectSaveContext)
+{
+    UObject::PreSave(ObjectSaveContext);
+
+    StrippedFileBulkData.RemoveBulkData();
+    StrippedAssetIds.Empty();
+    if (ObjectSaveContext.IsCooking() &&
+        CVarRiveCookStripAssets.GetValueOnAnyThread() != 0)
+    {
+        StripInBandAssets();
+    }
+}
+
+void URiveFile::StripInBandAssets()
+{
+    TSet<uint32> OutOfBandAssetIds;
+    for (const TTuple<uint32, TObjectPtr<URiveAsset>>& Asset : Assets)
+    {
+        if (Asset.Value && !Asset.Value->NativeAssetBytes.IsEmpty())
+        {
+            OutOfBandAssetIds.Add(Asset.Key);
+        }
+    }
+
+    const int64 FileDataSize = RiveFileBulkData.GetBulkDataSize();
+    if (OutOfBandAssetIds.IsEmpty() || FileDataSize == 0)
+    {
+        return;
+    }
+
+    TArray<uint8> StrippedFileData;
+    const uint8* FileData =
+        static_cast<const uint8*>(RiveFileBulkData.LockReadOnly());
+    const bool bRead = RiveAssetHelpers::StripInBandAssets(
+        MakeArrayView(FileData, static_cast<int32>(FileDataSize)),
+        OutOfBandAssetIds,
+        StrippedFileData,
+        StrippedAssetIds);
+    RiveFileBulkData.Unlock();
+
+    if (!bRead)
+    {
+        UE_LOG(LogRive,
+               Warning,
+               TEXT("Could not read '%s' to strip its in-band assets, it is "
+                    "cooked as is."),
+               *GetPathName());
+        return;
+    }
+
+    if (StrippedAssetIds.IsEmpty())
+    {
+        return;
+    }
+
+    StrippedFileBulkData.Lock(LOCK_READ_WRITE);
+    void* Data = StrippedFileBulkData.Realloc(StrippedFileData.Num());
+    FMemory::Memcpy(Data, StrippedFileData.GetData(), StrippedFileData.Num());
+    StrippedFileBulkData.Unlock();
+
+    // The file data stays resident once loaded, what is saved on disk is
+    // also saved in memory, on top of decoding the stripped assets
+    UE_LOG(LogRive,
+           Display,
+           TEXT("Stripped %d in-band asset(s) supplied out of band from '%s', "
+                "saving %lld of %lld bytes on disk and in memory."),
+           StrippedAssetIds.Num(),
+           *GetPathName(),
+           FileDataSize - StrippedFileData.Num(),
+           FileDataSize);
+}
+#endif // WITH_EDITOR
+
+void URiveFile::SetFileData(const TArray<uint8>& InFileData)
+{
+    RiveFileBulkData.Lock(LOCK_READ_WRITE);
+    void* FileData = RiveFileBulkData.Realloc(InFileData.Num());
+    FMemory::Memcpy(FileData, InFileData.GetData(), InFileData.Num());
+    RiveFileBulkData.Unlock();
+
+    // Points to the data we just replaced
+    RiveNativeFileSpan = {};
+}
+
 void URiveFile::PostLoad()
 {
     UObject::PostLoad();
 
+    if (!RiveFileData_DEPRECATED.IsEmpty())
+    {
+        SetFileData(RiveFileData_DEPRECATED);
+        RiveFileData_DEPRECATED.Empty();
+    }
+
+    ArtboardNames.Reset(ArtboardInfos.Num());
+    for (const FRiveArtboardInfo& ArtboardInfo : ArtboardInfos)
+    {
+        ArtboardNames.Add(ArtboardInfo.Name);
+    }
+
     if (!IsRunningCommandlet())
     {
         IRiveRendererModule::Get().CallOrRegister_OnRendererInitialized(
@@ -71,6 +395,7 @@ void URiveFile::Initialize()
     WasLastInitializationSuccessful.Reset();
     InitState = ERiveInitState::Initializing;
     OnStartInitializingDelegate.Broadcast();
+    ArtboardMetadata.Empty();
 
     if (!IRiveRendererModule::IsAvailable())
     {
@@ -97,7 +422,8 @@ void URiveFile::Initialize()
 #if WITH_RIVE
     if (RiveNativeFileSpan.empty() || bNeedsImport)
     {
-        if (RiveFileData.IsEmpty())
+        const int64 FileDataSize = RiveFileBulkData.GetBulkDataSize();
+        if (FileDataSize == 0)
         {
             UE_LOG(LogRive,
                    Error,
@@ -105,8 +431,14 @@ void URiveFile::Initialize()
             BroadcastInitializationResult(false);
             return;
         }
-        RiveNativeFileSpan =
-            rive::make_span(RiveFileData.GetData(), RiveFileData.Num());
+
+        // Reads the data the first time, unless mapped, and keeps it resident
+        // for as long as we live, imports read it in place
+        SCOPE_CYCLE_COUNTER(STAT_RiveFileDataLoad);
+        const uint8* FileData =
+            static_cast<const uint8*>(RiveFileBulkData.LockReadOnly());
+        RiveNativeFileSpan = rive::make_span(FileData, FileDataSize);
+        RiveFileBulkData.Unlock();
     }
 
     InitState = ERiveInitState::Initializing;
@@ -114,86 +446,319 @@ void URiveFile::Initialize()
     RiveRenderer->CallOrRegister_OnInitialized(
         IRiveRenderer::FOnRendererInitialized::FDelegate::CreateLambda(
             [this](IRiveRenderer* RiveRenderer) {
-                rive::gpu::RenderContext* RenderContext;
+                bool bIsEditorImport = false;
+
+#if WITH_EDITORONLY_DATA
+                if (bNeedsImport)
                 {
-                    FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
-                    RenderContext = RiveRenderer->GetRenderContext();
+                    // Finds or creates the asset objects, which the game
+                    // thread alone can do, and EditorImport expects the result
+                    // right away
+                    bNeedsImport = false;
+                    bIsEditorImport = true;
+                    const TUniquePtr<FRiveFileAssetImporter> AssetImporter =
+                        MakeUnique<FRiveFileAssetImporter>(
+                            GetOutermost(),
+                            AssetImportData->GetFirstFilename(),
+                            GetAssets());
+                    if (!UE::Private::RiveFile::ImportNativeFile(
+                            RiveRenderer,
+                            RiveNativeFileSpan,
+                            AssetImporter.Get()))
+                    {
+                        UE_LOG(LogRive,
+                               Error,
+                               TEXT("Failed to import rive file."));
+                        BroadcastInitializationResult(false);
+                        return;
+                    }
                 }
+#endif
 
-                if (ensure(RenderContext))
+                if (!bIsEditorImport &&
+                    CVarRiveAsyncImport.GetValueOnGameThread() != 0 &&
+                    FPlatformProcess::SupportsMultithreading())
                 {
-                    ArtboardNames.Empty();
-                    Artboards.Empty();
+                    StartAsyncImport(RiveRenderer);
+                    return;
+                }
 
-                    FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
-                    rive::ImportResult ImportResult;
+                FRiveFileAssetLoader FileAssetLoader(this, Assets);
+                FinishImport(RiveRenderer,
+                             UE::Private::RiveFile::LoadNativeFile(
+                                 RiveRenderer,
+                                 RiveNativeFileSpan,
+                                 FileAssetLoader),
+                             FileAssetLoader);
+            }));
+#endif // WITH_RIVE
+}
 
-#if WITH_EDITORONLY_DATA
-                    if (bNeedsImport)
-                    {
-                        bNeedsImport = false;
-                        const TUniquePtr<FRiveFileAssetImporter> AssetImporter =
-                            MakeUnique<FRiveFileAssetImporter>(
-                                GetOutermost(),
-                                AssetImportData->GetFirstFilename(),
-                                GetAssets());
-                        RiveNativeFilePtr =
-                            rive::File::import(RiveNativeFileSpan,
-                                               RenderContext,
-                                               &ImportResult,
-                                               AssetImporter.Get());
-                        if (ImportResult != rive::ImportResult::success)
-                        {
-                            UE_LOG(LogRive,
-                                   Error,
-                                   TEXT("Failed to import rive file."));
-                            Lock.Unlock();
-                            BroadcastInitializationResult(false);
-                            return;
-                        }
-                    }
-#endif
+TSharedPtr<const FRiveArtboardMetadata> URiveFile::GetArtboardMetadata(
+    const rive::Artboard* InNativeArtboard)
+{
+#if WITH_RIVE
+    if (InNativeArtboard == nullptr)
+    {
+        return nullptr;
+    }
 
-                    const TUniquePtr<FRiveFileAssetLoader> FileAssetLoader =
-                        MakeUnique<FRiveFileAssetLoader>(this, Assets);
-                    RiveNativeFilePtr =
-                        rive::File::import(RiveNativeFileSpan,
-                                           RenderContext,
-                                           &ImportResult,
-                                           FileAssetLoader.Get());
+    if (const TSharedPtr<const FRiveArtboardMetadata>* Found =
+            ArtboardMetadata.Find(InNativeArtboard))
+    {
+        return *Found;
+    }
+
+    TSharedPtr<FRiveArtboardMetadata> Metadata =
+        MakeShared<FRiveArtboardMetadata>();
+    Metadata->ArtboardName = InNativeArtboard->name().c_str();
+
+    Metadata->StateMachineNames.Reserve(InNativeArtboard->stateMachineCount());
+    for (size_t i = 0; i < InNativeArtboard->stateMachineCount(); ++i)
+    {
+        const rive::StateMachine* NativeStateMachine =
+            InNativeArtboard->stateMachine(i);
+        Metadata->StateMachineNames.Add(NativeStateMachine->name().c_str());
+    }
+
+    const std::vector<rive::Event*> Events =
+        const_cast<rive::Artboard*>(InNativeArtboard)->find<rive::Event>();
+    for (const rive::Event* Event : Events)
+    {
+        Metadata->EventNames.Add(Event->name().c_str());
+    }
+
+    ArtboardMetadata.Add(InNativeArtboard, Metadata);
+    return Metadata;
+#else
+    return nullptr;
+#endif // WITH_RIVE
+}
+
+URiveArtboard* URiveFile::PrewarmArtboard(const FString& InArtboardName,
+                                          const FString& InStateMachineName)
+{
+    SCOPE_CYCLE_COUNTER(STAT_RivePrewarmArtboard);
+    check(IsInGameThread());
+
+    const FString Key = InArtboardName + TEXT("/") + InStateMachineName;
+    if (const TObjectPtr<URiveArtboard>* Found = PrewarmedArtboards.Find(Key))
+    {
+        return *Found;
+    }
+
+#if WITH_RIVE
+    if (!IsInitialized())
+    {
+        UE_LOG(LogRive,
+               Warning,
+               TEXT("Can't prewarm an artboard of '%s' before it is "
+                    "initialized."),
+               *GetPathName());
+        return nullptr;
+    }
+
+    IRiveRenderer* RiveRenderer = IRiveRendererModule::IsAvailable()
+                                      ? IRiveRendererModule::Get().GetRenderer()
+                                      : nullptr;
+    if (!RiveRenderer || !RiveRenderer->IsInitialized())
+    {
+        UE_LOG(LogRive,
+               Warning,
+               TEXT("Can't prewarm an artboard of '%s' without an initialized "
+                    "Rive renderer."),
+               *GetPathName());
+        return nullptr;
+    }
 
-                    if (ImportResult != rive::ImportResult::success)
+    URiveArtboard* Artboard = NewObject<URiveArtboard>(this);
+    URiveTexture* Texture = NewObject<URiveTexture>(this);
+    const TSharedPtr<IRiveRenderTarget> RenderTarget =
+        RiveRenderer->CreateTextureTarget_GameThread(Texture->GetFName(),
+                                                     Texture);
+    RenderTarget->SetClearColor(FLinearColor::Transparent);
+
+    Artboard->Initialize(this,
+                         RenderTarget,
+                         InArtboardName,
+                         InStateMachineName);
+    if (!Artboard->IsInitialized())
+    {
+        RiveRenderer->ReleaseTextureTarget_GameThread(Texture->GetFName());
+        return nullptr;
+    }
+
+    // Drawn at its own size, the pooled texture behind it is then free for
+    // the first target of that size once we let go of it below
+    const rive::AABB Bounds = Artboard->GetBounds();
+    const FIntPoint Size(FMath::Clamp(FMath::CeilToInt32(Bounds.width()),
+                                      1,
+                                      RIVE_MAX_TEX_RESOLUTION),
+                         FMath::Clamp(FMath::CeilToInt32(Bounds.height()),
+                                      1,
+                                      RIVE_MAX_TEX_RESOLUTION));
+    Texture->ResizeRenderTargets(Size);
+    RenderTarget->Initialize();
+
+    RenderTarget->Save();
+    Artboard->Align(ERiveFitType::Contain, ERiveAlignment::Center, 1.f);
+    Artboard->Tick(0.f);
+    RenderTarget->Restore();
+    RenderTarget->SubmitAndClear();
+    RiveRenderer->FlushPendingRenderTargets_GameThread();
+
+    // Only the artboard is kept, whoever takes it draws it into its own
+    // target
+    Artboard->SetRenderTarget(nullptr);
+    RiveRenderer->ReleaseTextureTarget_GameThread(Texture->GetFName());
+    Texture->ReleaseResource();
+    Texture->MarkAsGarbage();
+
+    PrewarmedArtboards.Add(Key, Artboard);
+    return Artboard;
+#else
+    return nullptr;
+#endif // WITH_RIVE
+}
+
+URiveArtboard* URiveFile::TakePrewarmedArtboard(
+    const FString& InArtboardName,
+    const FString& InStateMachineName)
+{
+    TObjectPtr<URiveArtboard> Artboard;
+    PrewarmedArtboards.RemoveAndCopyValue(InArtboardName + TEXT("/") +
+                                              InStateMachineName,
+                                          Artboard);
+    // Only initialized artboards are prewarmed, one that isn't anymore went
+    // through a reimport and is of no use
+    return Artboard && Artboard->IsInitialized() ? Artboard.Get() : nullptr;
+}
+
+void URiveFile::ReleasePrewarmedArtboards() { PrewarmedArtboards.Empty(); }
+
+#if WITH_RIVE
+
+void URiveFile::StartAsyncImport(IRiveRenderer* InRiveRenderer)
+{
+    UE::Private::RiveFile::FImportCompletionQueue& CompletionQueue =
+        UE::Private::RiveFile::FImportCompletionQueue::Get();
+    TSharedRef<FRiveFileAssetLoader> FileAssetLoader =
+        MakeShared<FRiveFileAssetLoader>(this, Assets);
+
+    // We can't be destroyed until the task is done with our data and assets,
+    // see IsReadyForFinishDestroy
+    ImportTask = UE::Tasks::Launch(
+        TEXT("Rive.ImportFile"),
+        [WeakThis = TWeakObjectPtr<URiveFile>(this),
+         InRiveRenderer,
+         FileSpan = RiveNativeFileSpan,
+         FileAssetLoader,
+         &CompletionQueue]() {
+            std::unique_ptr<rive::File> NativeFile =
+                UE::Private::RiveFile::LoadNativeFile(InRiveRenderer,
+                                                      FileSpan,
+                                                      FileAssetLoader.Get());
+
+            CompletionQueue.Enqueue(
+                [WeakThis,
+                 InRiveRenderer,
+                 NativeFile = std::move(NativeFile),
+                 FileAssetLoader]() mutable {
+                    if (URiveFile* RiveFile = WeakThis.Get())
                     {
-                        UE_LOG(LogRive,
-                               Error,
-                               TEXT("Failed to load rive file."));
-                        Lock.Unlock();
-                        BroadcastInitializationResult(false);
-                        return;
+                        RiveFile->FinishImport(InRiveRenderer,
+                                               std::move(NativeFile),
+                                               *FileAssetLoader);
                     }
+                });
+        });
+}
 
-                    // UI Helper
-                    for (int i = 0; i < RiveNativeFilePtr->artboardCount(); ++i)
-                    {
-                        auto Artboard = NewObject<URiveArtboard>();
+void URiveFile::FinishImport(IRiveRenderer* InRiveRenderer,
+                             std::unique_ptr<rive::File>&& InNativeFile,
+                             FRiveFileAssetLoader& InAssetLoader)
+{
+    SCOPE_CYCLE_COUNTER(STAT_RiveFileImportCompletion);
+    check(IsInGameThread());
 
-                        // We won't tick the artboard, it's just initialized for
-                        // informational purposes
-                        Artboard->Initialize(this, nullptr, i, "");
-                        Artboards.Add(Artboard);
-                        ArtboardNames.Add(Artboard->GetArtboardName());
-                    }
+    if (!InNativeFile)
+    {
+        UE_LOG(LogRive, Error, TEXT("Failed to load rive file."));
+        BroadcastInitializationResult(false);
+        return;
+    }
 
-                    BroadcastInitializationResult(true);
-                    return;
+    InAssetLoader.FinishLoading();
+
+    {
+        // The rendering thread may still draw the file we replace
+        FScopeLock Lock(&InRiveRenderer->GetThreadDataCS());
+        RiveNativeFilePtr = std::move(InNativeFile);
+    }
+    FRiveAssetCache::Get().Trim();
+
+    BuildArtboardInfos();
+
+    BroadcastInitializationResult(true);
+}
+
+void URiveFile::BuildArtboardInfos()
+{
+    SCOPE_CYCLE_COUNTER(STAT_RiveBuildArtboardInfos);
+
+    // Source artboards are read as they are, nothing gets instanced
+    const size_t ArtboardCount = RiveNativeFilePtr->artboardCount();
+    ArtboardInfos.Reset(ArtboardCount);
+    ArtboardNames.Reset(ArtboardCount);
+    for (size_t i = 0; i < ArtboardCount; ++i)
+    {
+        rive::Artboard* NativeArtboard = RiveNativeFilePtr->artboard(i);
+        FRiveArtboardInfo& ArtboardInfo = ArtboardInfos.AddDefaulted_GetRef();
+        ArtboardInfo.Name = UTF8_TO_TCHAR(NativeArtboard->name().c_str());
+        ArtboardNames.Add(ArtboardInfo.Name);
+
+        ArtboardInfo.StateMachines.Reserve(NativeArtboard->stateMachineCount());
+        for (size_t j = 0; j < NativeArtboard->stateMachineCount(); ++j)
+        {
+            const rive::StateMachine* NativeStateMachine =
+                NativeArtboard->stateMachine(j);
+            FRiveStateMachineInfo& StateMachineInfo =
+                ArtboardInfo.StateMachines.AddDefaulted_GetRef();
+            StateMachineInfo.Name =
+                UTF8_TO_TCHAR(NativeStateMachine->name().c_str());
+
+            StateMachineInfo.Inputs.Reserve(NativeStateMachine->inputCount());
+            for (size_t k = 0; k < NativeStateMachine->inputCount(); ++k)
+            {
+                const rive::StateMachineInput* NativeInput =
+                    NativeStateMachine->input(k);
+                FRiveInputInfo& InputInfo =
+                    StateMachineInfo.Inputs.AddDefaulted_GetRef();
+                InputInfo.Name = UTF8_TO_TCHAR(NativeInput->name().c_str());
+                if (NativeInput->is<rive::StateMachineBool>())
+                {
+                    InputInfo.Type = ERiveInputType::Bool;
                 }
+                else if (NativeInput->is<rive::StateMachineNumber>())
+                {
+                    InputInfo.Type = ERiveInputType::Number;
+                }
+                else if (NativeInput->is<rive::StateMachineTrigger>())
+                {
+                    InputInfo.Type = ERiveInputType::Trigger;
+                }
+            }
+        }
 
-                UE_LOG(LogRive, Error, TEXT("Failed to import rive file."));
-                BroadcastInitializationResult(false);
-            }));
-#endif // WITH_RIVE
+        for (const rive::Event* Event : NativeArtboard->find<rive::Event>())
+        {
+            ArtboardInfo.EventNames.Add(UTF8_TO_TCHAR(Event->name().c_str()));
+        }
+    }
 }
 
+#endif // WITH_RIVE
+
 void URiveFile::BroadcastInitializationResult(bool bSuccess)
 {
     WasLastInitializationSuccessful = bSuccess;
@@ -285,7 +850,10 @@ bool URiveFile::EditorImport(const FString& InRiveFilePath,
 
 #endif
 
-    RiveFileData = MoveTemp(InRiveFileBuffer);
+    // A pending import still reads the data we are about to replace
+    ImportTask.Wait();
+
+    SetFileData(InRiveFileBuffer);
     if (bIsReimport)
     {
         Initialize();
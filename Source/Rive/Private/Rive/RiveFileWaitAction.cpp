@@ -0,0 +1,53 @@
+// Copyright Rive, Inc. All rights reserved.
+
+#include "Rive/RiveFileWaitAction.h"
+
+#include "Rive/RiveFile.h"
+
+URiveFileWaitAction* URiveFileWaitAction::WaitForRiveFile(
+    UObject* WorldContextObject,
+    URiveFile* RiveFile)
+{
+    URiveFileWaitAction* Action = NewObject<URiveFileWaitAction>();
+    Action->RiveFile = RiveFile;
+    Action->RegisterWithGameInstance(WorldContextObject);
+    return Action;
+}
+
+void URiveFileWaitAction::Activate()
+{
+    if (!IsValid(RiveFile))
+    {
+        OnFileInitialized(false);
+        return;
+    }
+
+    if (RiveFile->IsInitialized())
+    {
+        OnFileInitialized(true);
+        return;
+    }
+
+    InitializedHandle = RiveFile->OnInitializedDelegate.AddUObject(
+        this,
+        &URiveFileWaitAction::OnFileInitialized);
+}
+
+void URiveFileWaitAction::OnFileInitialized(bool bSuccess)
+{
+    if (InitializedHandle.IsValid() && IsValid(RiveFile))
+    {
+        RiveFile->OnInitializedDelegate.Remove(InitializedHandle);
+        InitializedHandle.Reset();
+    }
+
+    if (bSuccess)
+    {
+        Initialized.Broadcast();
+    }
+    else
+    {
+        Failed.Broadcast();
+    }
+    SetReadyToDestroy();
+}
@@ -2,13 +2,12 @@
 
 #include "Rive/RiveStateMachine.h"
 
-#include "IRiveRenderer.h"
-#include "IRiveRendererModule.h"
 #include "Logs/RiveLog.h"
 #include "Stats/RiveStats.h"
 
 #if WITH_RIVE
 THIRD_PARTY_INCLUDES_START
+#include "rive/animation/state_machine.hpp"
 #include "rive/animation/state_machine_input_instance.hpp"
 #include "rive/generated/animation/state_machine_bool_base.hpp"
 #include "rive/generated/animation/state_machine_number_base.hpp"
@@ -23,13 +22,11 @@ rive::EventReport FRiveStateMachine::NullEvent =
 
 FRiveStateMachine::FRiveStateMachine(
     rive::ArtboardInstance* InNativeArtboardInst,
-    const FString& InStateMachineName)
+    const FString& InStateMachineName,
+    const FRiveArtboardCSPtr& InArtboardCS) :
+    ArtboardCS(InArtboardCS)
 {
-    IRiveRenderer* RiveRenderer = IRiveRendererModule::Get().GetRenderer();
-    if (ensure(RiveRenderer))
-    {
-        RiveRenderer->GetThreadDataCS().Lock();
-    }
+    FScopeLock Lock(ArtboardCS.Get());
 
     if (InStateMachineName.IsEmpty())
     {
@@ -80,11 +77,6 @@ FRiveStateMachine::FRiveStateMachine(
             }
         }
     }
-
-    if (RiveRenderer)
-    {
-        RiveRenderer->GetThreadDataCS().Unlock();
-    }
 }
 
 bool FRiveStateMachine::Advance(float InSeconds)
@@ -93,17 +85,7 @@ bool FRiveStateMachine::Advance(float InSeconds)
     DECLARE_SCOPE_CYCLE_COUNTER(TEXT("FRiveStateMachine::Advance"),
                                 STAT_STATEMACHINE_ADVANCE,
                                 STATGROUP_Rive);
-    IRiveRenderer* RiveRenderer = IRiveRendererModule::Get().GetRenderer();
-    if (!RiveRenderer)
-    {
-        UE_LOG(LogRive,
-               Error,
-               TEXT("Failed to Advance the StateMachine as we do not have a "
-                    "valid renderer."));
-        return false;
-    }
-
-    FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
+    FScopeLock Lock(ArtboardCS.Get());
 
     if (NativeStateMachinePtr)
     {
@@ -115,17 +97,7 @@ bool FRiveStateMachine::Advance(float InSeconds)
 
 uint32 FRiveStateMachine::GetInputCount() const
 {
-    IRiveRenderer* RiveRenderer = IRiveRendererModule::Get().GetRenderer();
-    if (!RiveRenderer)
-    {
-        UE_LOG(LogRive,
-               Error,
-               TEXT("Failed to GetInputCount on the StateMachine as we do not "
-                    "have a valid renderer."));
-        return 0;
-    }
-
-    FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
+    FScopeLock Lock(ArtboardCS.Get());
 
     if (NativeStateMachinePtr)
     {
@@ -137,17 +109,7 @@ uint32 FRiveStateMachine::GetInputCount() const
 
 rive::SMIInput* FRiveStateMachine::GetInput(uint32 AtIndex) const
 {
-    IRiveRenderer* RiveRenderer = IRiveRendererModule::Get().GetRenderer();
-    if (!RiveRenderer)
-    {
-        UE_LOG(LogRive,
-               Error,
-               TEXT("Failed to GetInput on the StateMachine as we do not have "
-                    "a valid renderer."));
-        return nullptr;
-    }
-
-    FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
+    FScopeLock Lock(ArtboardCS.Get());
 
     if (NativeStateMachinePtr)
     {
@@ -157,10 +119,43 @@ rive::SMIInput* FRiveStateMachine::GetInput(uint32 AtIndex) const
     return nullptr;
 }
 
+void FRiveStateMachine::GetInputValues(TArray<float>& OutValues) const
+{
+    FScopeLock Lock(ArtboardCS.Get());
+
+    if (!NativeStateMachinePtr)
+    {
+        return;
+    }
+
+    for (size_t Index = 0; Index < NativeStateMachinePtr->inputCount();
+         ++Index)
+    {
+        const rive::SMIInput* Input = NativeStateMachinePtr->input(Index);
+        if (Input->input()->is<rive::StateMachineBoolBase>())
+        {
+            OutValues.Add(static_cast<const rive::SMIBool*>(Input)->value()
+                              ? 1.f
+                              : 0.f);
+        }
+        else if (Input->input()->is<rive::StateMachineNumberBase>())
+        {
+            OutValues.Add(static_cast<const rive::SMINumber*>(Input)->value());
+        }
+    }
+}
+
+bool FRiveStateMachine::IsStateDecidedByInputValues() const
+{
+    FScopeLock Lock(ArtboardCS.Get());
+
+    return NativeStateMachinePtr && TriggerInputNames.IsEmpty() &&
+           NativeStateMachinePtr->stateMachine()->listenerCount() == 0;
+}
+
 void FRiveStateMachine::FireTrigger(const FString& InPropertyName) const
 {
-    IRiveRenderer* RiveRenderer = IRiveRendererModule::Get().GetRenderer();
-    FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
+    FScopeLock Lock(ArtboardCS.Get());
 
     if (!NativeStateMachinePtr)
     {
@@ -183,17 +178,7 @@ void FRiveStateMachine::FireTrigger(const FString& InPropertyName) const
 
 bool FRiveStateMachine::GetBoolValue(const FString& InPropertyName) const
 {
-    IRiveRenderer* RiveRenderer = IRiveRendererModule::Get().GetRenderer();
-    if (!RiveRenderer)
-    {
-        UE_LOG(LogRive,
-               Error,
-               TEXT("Failed to GetBoolValue on the StateMachine as we do not "
-                    "have a valid renderer."));
-        return false;
-    }
-
-    FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
+    FScopeLock Lock(ArtboardCS.Get());
 
     if (!NativeStateMachinePtr)
     {
@@ -216,18 +201,7 @@ bool FRiveStateMachine::GetBoolValue(const FString& InPropertyName) const
 
 float FRiveStateMachine::GetNumberValue(const FString& InPropertyName) const
 {
-    IRiveRenderer* RiveRenderer = IRiveRendererModule::Get().GetRenderer();
-    if (!RiveRenderer)
-    {
-        UE_LOG(LogRive,
-               Error,
-               TEXT("Failed to GetNumberValue on the StateMachine as we do not "
-                    "have a valid "
-                    "renderer."));
-        return 0.f;
-    }
-
-    FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
+    FScopeLock Lock(ArtboardCS.Get());
 
     if (!NativeStateMachinePtr)
     {
@@ -251,17 +225,7 @@ float FRiveStateMachine::GetNumberValue(const FString& InPropertyName) const
 void FRiveStateMachine::SetBoolValue(const FString& InPropertyName,
                                      bool bNewValue)
 {
-    IRiveRenderer* RiveRenderer = IRiveRendererModule::Get().GetRenderer();
-    if (!RiveRenderer)
-    {
-        UE_LOG(LogRive,
-               Error,
-               TEXT("Failed to SetBoolValue on the StateMachine as we do not "
-                    "have a valid renderer."));
-        return;
-    }
-
-    FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
+    FScopeLock Lock(ArtboardCS.Get());
 
     if (!NativeStateMachinePtr)
     {
@@ -285,18 +249,7 @@ void FRiveStateMachine::SetBoolValue(const FString& InPropertyName,
 void FRiveStateMachine::SetNumberValue(const FString& InPropertyName,
                                        float NewValue)
 {
-    IRiveRenderer* RiveRenderer = IRiveRendererModule::Get().GetRenderer();
-    if (!RiveRenderer)
-    {
-        UE_LOG(LogRive,
-               Error,
-               TEXT("Failed to SetNumberValue on the StateMachine as we do not "
-                    "have a valid "
-                    "renderer."));
-        return;
-    }
-
-    FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
+    FScopeLock Lock(ArtboardCS.Get());
 
     if (!NativeStateMachinePtr)
     {
@@ -319,18 +272,7 @@ void FRiveStateMachine::SetNumberValue(const FString& InPropertyName,
 
 bool FRiveStateMachine::PointerDown(const FVector2f& NewPosition)
 {
-    IRiveRenderer* RiveRenderer = IRiveRendererModule::Get().GetRenderer();
-    if (!RiveRenderer)
-    {
-        UE_LOG(LogRive,
-               Error,
-               TEXT("Failed to call PointerDown on the StateMachine as we do "
-                    "not have a valid "
-                    "renderer."));
-        return false;
-    }
-
-    FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
+    FScopeLock Lock(ArtboardCS.Get());
 
     if (!NativeStateMachinePtr)
     {
@@ -344,18 +286,7 @@ bool FRiveStateMachine::PointerDown(const FVector2f& NewPosition)
 
 bool FRiveStateMachine::PointerMove(const FVector2f& NewPosition)
 {
-    IRiveRenderer* RiveRenderer = IRiveRendererModule::Get().GetRenderer();
-    if (!RiveRenderer)
-    {
-        UE_LOG(LogRive,
-               Error,
-               TEXT("Failed to call PointerMove on the StateMachine as we do "
-                    "not have a valid "
-                    "renderer."));
-        return false;
-    }
-
-    FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
+    FScopeLock Lock(ArtboardCS.Get());
 
     if (!NativeStateMachinePtr)
     {
@@ -369,18 +300,7 @@ bool FRiveStateMachine::PointerMove(const FVector2f& NewPosition)
 
 bool FRiveStateMachine::PointerUp(const FVector2f& NewPosition)
 {
-    IRiveRenderer* RiveRenderer = IRiveRendererModule::Get().GetRenderer();
-    if (!RiveRenderer)
-    {
-        UE_LOG(LogRive,
-               Error,
-               TEXT("Failed to call PointerUp on the StateMachine as we do not "
-                    "have a valid "
-                    "renderer."));
-        return false;
-    }
-
-    FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
+    FScopeLock Lock(ArtboardCS.Get());
 
     if (!NativeStateMachinePtr)
     {
@@ -394,18 +314,7 @@ bool FRiveStateMachine::PointerUp(const FVector2f& NewPosition)
 
 bool FRiveStateMachine::PointerExit(const FVector2f& NewPosition)
 {
-    IRiveRenderer* RiveRenderer = IRiveRendererModule::Get().GetRenderer();
-    if (!RiveRenderer)
-    {
-        UE_LOG(LogRive,
-               Error,
-               TEXT("Failed to call PointerExit on the StateMachine as we do "
-                    "not have a valid "
-                    "renderer."));
-        return false;
-    }
-
-    FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
+    FScopeLock Lock(ArtboardCS.Get());
 
     if (!NativeStateMachinePtr)
     {
@@ -419,18 +328,7 @@ bool FRiveStateMachine::PointerExit(const FVector2f& NewPosition)
 
 const rive::EventReport FRiveStateMachine::GetReportedEvent(int32 AtIndex) const
 {
-    IRiveRenderer* RiveRenderer = IRiveRendererModule::Get().GetRenderer();
-    if (!RiveRenderer)
-    {
-        UE_LOG(LogRive,
-               Error,
-               TEXT("Failed to GetReportedEvent on the StateMachine as we do "
-                    "not have a valid "
-                    "renderer."));
-        return NullEvent;
-    }
-
-    FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
+    FScopeLock Lock(ArtboardCS.Get());
 
     if (!NativeStateMachinePtr || !HasAnyReportedEvents())
     {
@@ -442,18 +340,7 @@ const rive::EventReport FRiveStateMachine::GetReportedEvent(int32 AtIndex) const
 
 int32 FRiveStateMachine::GetReportedEventsCount() const
 {
-    IRiveRenderer* RiveRenderer = IRiveRendererModule::Get().GetRenderer();
-    if (!RiveRenderer)
-    {
-        UE_LOG(LogRive,
-               Error,
-               TEXT("Failed to GetReportedEventsCount on the StateMachine as "
-                    "we do not have a "
-                    "valid renderer."));
-        return 0;
-    }
-
-    FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
+    FScopeLock Lock(ArtboardCS.Get());
 
     if (!NativeStateMachinePtr || !HasAnyReportedEvents())
     {
@@ -465,18 +352,7 @@ int32 FRiveStateMachine::GetReportedEventsCount() const
 
 bool FRiveStateMachine::HasAnyReportedEvents() const
 {
-    IRiveRenderer* RiveRenderer = IRiveRendererModule::Get().GetRenderer();
-    if (!RiveRenderer)
-    {
-        UE_LOG(LogRive,
-               Error,
-               TEXT("Failed to HasAnyReportedEvents on the StateMachine as we "
-                    "do not have a valid "
-                    "renderer."));
-        return false;
-    }
-
-    FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
+    FScopeLock Lock(ArtboardCS.Get());
 
     if (!NativeStateMachinePtr)
     {
@@ -9,6 +9,14 @@
 #include "Rive/RiveArtboard.h"
 #include "RiveTextureResource.h"
 
+static TAutoConsoleVariable<int32> CVarRiveTextureResizeBucket(
+    TEXT("r.rive.texture.resizebucket"),
+    64,
+    TEXT("Rive textures resized continuously, such as the ones of Rive "
+         "widgets, allocate their render target in steps of this many pixels "
+         "and only draw into the requested size. 0 or 1 disables bucketing."),
+    ECVF_Default);
+
 URiveTexture::URiveTexture()
 {
     SRGB = true;
@@ -78,13 +86,13 @@ void URiveTexture::ResizeRenderTargets(FIntPoint InNewSize)
         return;
     }
 
-    // we need to make sure we are not drawing anything with the old size,
-    // so we ensure all the commands are sent before going further
-    FlushRenderingCommands();
-
     SizeX = Size.X = InNewSize.X;
     SizeY = Size.Y = InNewSize.Y;
 
+    // No flush needed: the new texture is created and swapped in by a render
+    // command, so frames queued before keep drawing into the old one, which
+    // stays displayed until then, and render targets size their frames from
+    // the texture they draw into
     if (!CurrentResource)
     {
         // Create Resource
@@ -95,8 +103,21 @@ void URiveTexture::ResizeRenderTargets(FIntPoint InNewSize)
         // Create new TextureRHI with new size
         InitializeResources();
     }
+}
+
+FIntPoint URiveTexture::GetResizeBucketSize(const FIntPoint& InSize)
+{
+    const int32 Bucket = CVarRiveTextureResizeBucket.GetValueOnGameThread();
+    if (Bucket <= 1)
+    {
+        return InSize;
+    }
 
-    FlushRenderingCommands();
+    return FIntPoint(
+        FMath::Min(FMath::DivideAndRoundUp(InSize.X, Bucket) * Bucket,
+                   RIVE_MAX_TEX_RESOLUTION),
+        FMath::Min(FMath::DivideAndRoundUp(InSize.Y, Bucket) * Bucket,
+                   RIVE_MAX_TEX_RESOLUTION));
 }
 
 void URiveTexture::ResizeRenderTargets(const FVector2f InNewSize)
@@ -142,8 +163,9 @@ void URiveTexture::InitializeResources() const
         return;
     }
 
+    // The size is copied as the game thread may resize again before this runs
     ENQUEUE_RENDER_COMMAND(FRiveTextureResourceeUpdateTextureReference)
-    ([this](FRHICommandListImmediate& RHICmdList) {
+    ([this, Size = Size](FRHICommandListImmediate& RHICmdList) {
         IRiveRenderer* RiveRenderer = IRiveRendererModule::Get().GetRenderer();
         FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
 
@@ -164,7 +186,11 @@ void URiveTexture::InitializeResources() const
         }
 #endif
 
-        RenderableTexture = RHICreateTexture(RenderTargetTextureDesc);
+        // Widgets rebuilt and list entries recycled get the texture a
+        // previous Rive texture of the same size let go of
+        RenderableTexture = RiveRenderer->CreatePooledTexture_RenderThread(
+            RHICmdList,
+            RenderTargetTextureDesc);
         RenderableTexture->SetName(GetFName());
         CurrentResource->TextureRHI = RenderableTexture;
 
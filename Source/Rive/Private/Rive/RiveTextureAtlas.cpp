@@ -0,0 +1,298 @@
+// Copyright Rive, Inc. All rights reserved.
+
+#include "Rive/RiveTextureAtlas.h"
+
+#include "IRiveRenderer.h"
+#include "Rive/RiveArtboard.h"
+#include "Rive/RiveTextureObject.h"
+#include "Stats/RiveStats.h"
+
+static TAutoConsoleVariable<int32> CVarRiveAtlasPageSize(
+    TEXT("r.rive.atlas.pagesize"),
+    2048,
+    TEXT("Size in pixels of the shared atlas pages used by Rive widgets with "
+         "bUseSharedAtlas. Only affects pages created afterwards."),
+    ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarRiveAtlasMaxSlotSize(
+    TEXT("r.rive.atlas.maxslotsize"),
+    256,
+    TEXT("Widgets larger than this, in pixels, get their own render target "
+         "instead of a slot in the shared Rive atlas."),
+    ECVF_Default);
+
+namespace UE::Private::RiveTextureAtlas
+{
+// Keeps bilinear sampling of a slot from picking up its neighbours
+constexpr int32 SlotPadding = 2;
+} // namespace UE::Private::RiveTextureAtlas
+
+void URiveTextureAtlas::BeginDestroy()
+{
+    Slots.Empty();
+    RiveRenderTarget.Reset();
+
+    Super::BeginDestroy();
+}
+
+TStatId URiveTextureAtlas::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(URiveTextureAtlas, STATGROUP_Tickables);
+}
+
+void URiveTextureAtlas::Tick(float InDeltaSeconds)
+{
+    if (!RiveRenderTarget)
+    {
+        return;
+    }
+
+    if (URiveTickSubsystem* TickSubsystem = URiveTickSubsystem::Get())
+    {
+        TickSubsystem->QueueTick(this, this, InDeltaSeconds);
+        return;
+    }
+
+    TArray<URiveArtboard*> Artboards;
+    GatherArtboards(Artboards);
+    URiveArtboard::AdvanceStateMachines(Artboards, InDeltaSeconds);
+    TickRender(InDeltaSeconds);
+}
+
+void URiveTextureAtlas::GatherArtboards(TArray<URiveArtboard*>& OutArtboards)
+{
+    for (const FSlot& Slot : Slots)
+    {
+        if (URiveTextureObject* Owner = Slot.Owner.Get())
+        {
+            Owner->GatherArtboards(OutArtboards);
+        }
+    }
+}
+
+void URiveTextureAtlas::TickRender(float InDeltaSeconds)
+{
+    SCOPED_NAMED_EVENT_TEXT("URiveTextureAtlas::TickRender", FColor::White);
+    DECLARE_SCOPE_CYCLE_COUNTER(TEXT("RiveTextureAtlas::TickRender"),
+                                STAT_RIVETEXTUREATLAS_TICKRENDER,
+                                STATGROUP_Rive);
+
+    if (!RiveRenderTarget)
+    {
+        return;
+    }
+
+    // Every owner records its draw commands into our shared render target,
+    // then the whole page goes out in a single submit
+    bool bHasStaleSlots = false;
+    for (const FSlot& Slot : Slots)
+    {
+        if (URiveTextureObject* Owner = Slot.Owner.Get())
+        {
+            Owner->TickRender(InDeltaSeconds);
+        }
+        else
+        {
+            bHasStaleSlots = true;
+        }
+    }
+
+    // Give the space of destroyed widgets back to the others
+    if (bHasStaleSlots)
+    {
+        Repack();
+    }
+
+    RiveRenderTarget->SubmitAndClear();
+}
+
+ERiveTickPriority URiveTextureAtlas::GetTickPriority() const
+{
+    // The page ticks as a whole, as soon as one of its widgets has to
+    ERiveTickPriority Priority = ERiveTickPriority::Low;
+    for (const FSlot& Slot : Slots)
+    {
+        if (const URiveTextureObject* Owner = Slot.Owner.Get())
+        {
+            Priority = FMath::Max(Priority, Owner->GetTickPriority());
+        }
+    }
+    return Priority;
+}
+
+int32 URiveTextureAtlas::GetPageSize()
+{
+    return FMath::Clamp(CVarRiveAtlasPageSize.GetValueOnGameThread(),
+                        RIVE_MIN_TEX_RESOLUTION,
+                        RIVE_MAX_TEX_RESOLUTION);
+}
+
+int32 URiveTextureAtlas::GetMaxSlotSize()
+{
+    return FMath::Min(CVarRiveAtlasMaxSlotSize.GetValueOnGameThread(),
+                      GetPageSize());
+}
+
+void URiveTextureAtlas::Initialize(IRiveRenderer* InRiveRenderer)
+{
+    check(InRiveRenderer);
+
+    RiveRenderTarget =
+        InRiveRenderer->CreateTextureTarget_GameThread(GetFName(), this);
+    RiveRenderTarget->SetClearColor(FLinearColor::Transparent);
+
+    OnResourceInitializedOnRenderThread.AddUObject(
+        this,
+        &URiveTextureAtlas::OnResourceInitialized_RenderThread);
+
+    const int32 PageSize = GetPageSize();
+    ResizeRenderTargets(FIntPoint(PageSize, PageSize));
+
+    RiveRenderTarget->Initialize();
+}
+
+bool URiveTextureAtlas::AddSlot(URiveTextureObject* InOwner,
+                                const FIntPoint& InSize)
+{
+    check(InOwner);
+
+    FSlot& Slot = Slots.AddDefaulted_GetRef();
+    Slot.Owner = InOwner;
+    Slot.Size = InSize;
+
+    if (!Repack())
+    {
+        Slots.Pop();
+        Repack();
+        return false;
+    }
+
+    return true;
+}
+
+bool URiveTextureAtlas::ResizeSlot(URiveTextureObject* InOwner,
+                                   const FIntPoint& InSize)
+{
+    FSlot* Slot = Slots.FindByPredicate(
+        [InOwner](const FSlot& Other) { return Other.Owner == InOwner; });
+    if (Slot == nullptr)
+    {
+        return false;
+    }
+
+    if (Slot->Size == InSize)
+    {
+        return true;
+    }
+
+    const FIntPoint OldSize = Slot->Size;
+    Slot->Size = InSize;
+    if (!Repack())
+    {
+        // Slot may have moved in the array while repacking stale entries
+        Slot = Slots.FindByPredicate(
+            [InOwner](const FSlot& Other) { return Other.Owner == InOwner; });
+        Slot->Size = OldSize;
+        Repack();
+        return false;
+    }
+
+    return true;
+}
+
+void URiveTextureAtlas::RemoveSlot(URiveTextureObject* InOwner)
+{
+    if (Slots.RemoveAll([InOwner](const FSlot& Slot) {
+            return Slot.Owner == InOwner;
+        }) > 0)
+    {
+        Repack();
+    }
+}
+
+FIntRect URiveTextureAtlas::GetSlotRect(const URiveTextureObject* InOwner) const
+{
+    const FSlot* Slot = Slots.FindByPredicate(
+        [InOwner](const FSlot& Other) { return Other.Owner == InOwner; });
+    return Slot ? Slot->Rect : FIntRect();
+}
+
+FBox2f URiveTextureAtlas::GetSlotUVRegion(
+    const URiveTextureObject* InOwner) const
+{
+    const FIntRect Rect = GetSlotRect(InOwner);
+    const FVector2f PageSize(Size.X, Size.Y);
+    return FBox2f(FVector2f(Rect.Min) / PageSize,
+                  FVector2f(Rect.Max) / PageSize);
+}
+
+bool URiveTextureAtlas::Repack()
+{
+    using namespace UE::Private::RiveTextureAtlas;
+
+    Slots.RemoveAll([](const FSlot& Slot) { return !Slot.Owner.IsValid(); });
+
+    TArray<int32> Order;
+    Order.Reserve(Slots.Num());
+    for (int32 Index = 0; Index < Slots.Num(); ++Index)
+    {
+        Order.Add(Index);
+    }
+    Order.Sort([this](int32 A, int32 B) {
+        return Slots[A].Size.Y > Slots[B].Size.Y;
+    });
+
+    TArray<FIntRect> Rects;
+    Rects.SetNum(Slots.Num());
+
+    int32 X = SlotPadding;
+    int32 Y = SlotPadding;
+    int32 ShelfHeight = 0;
+    for (const int32 Index : Order)
+    {
+        const FIntPoint& SlotSize = Slots[Index].Size;
+        if (X + SlotSize.X + SlotPadding > Size.X)
+        {
+            // Start a new shelf below the current one
+            X = SlotPadding;
+            Y += ShelfHeight + SlotPadding;
+            ShelfHeight = 0;
+        }
+
+        if (X + SlotSize.X + SlotPadding > Size.X ||
+            Y + SlotSize.Y + SlotPadding > Size.Y)
+        {
+            return false;
+        }
+
+        Rects[Index] = FIntRect(X, Y, X + SlotSize.X, Y + SlotSize.Y);
+        X += SlotSize.X + SlotPadding;
+        ShelfHeight = FMath::Max(ShelfHeight, SlotSize.Y);
+    }
+
+    for (int32 Index = 0; Index < Slots.Num(); ++Index)
+    {
+        if (Slots[Index].Rect == Rects[Index])
+        {
+            continue;
+        }
+
+        Slots[Index].Rect = Rects[Index];
+        if (URiveTextureObject* Owner = Slots[Index].Owner.Get())
+        {
+            Owner->InvalidateDisplay();
+        }
+    }
+
+    return true;
+}
+
+void URiveTextureAtlas::OnResourceInitialized_RenderThread(
+    FRHICommandListImmediate& RHICmdList,
+    FTextureRHIRef& NewResource) const
+{
+    if (const TSharedPtr<IRiveRenderTarget> RenderTarget = RiveRenderTarget)
+    {
+        RenderTarget->CacheTextureTarget_RenderThread(RHICmdList, NewResource);
+    }
+}
@@ -11,7 +11,10 @@
 #include "Misc/Paths.h"
 #include "Async/Async.h"
 #include "RenderingThread.h"
+#include "Rive/RiveAtlasSubsystem.h"
 #include "Rive/RiveFile.h"
+#include "Rive/RiveTextureAtlas.h"
+#include "Slate/RiveSlateElement.h"
 
 #if WITH_RIVE
 THIRD_PARTY_INCLUDES_START
@@ -33,6 +36,8 @@ void URiveTextureObject::BeginDestroy()
 
     bIsRendering = false;
     OnRiveReady.Clear();
+    SlateRenderCommands.Empty();
+    ReleaseAtlasSlot();
     RiveRenderTarget.Reset();
 
     if (IsValid(Artboard))
@@ -86,17 +91,111 @@ void URiveTextureObject::Tick(float InDeltaSeconds)
     }
 
 #if WITH_RIVE
+    // Only widgets report when we are displayed, any other use of the texture
+    // counts as always visible
+    const float SecondsSinceDisplayed =
+        LastDisplayTime >= 0.0
+            ? static_cast<float>(FPlatformTime::Seconds() - LastDisplayTime)
+            : 0.f;
+
+    float TickDeltaSeconds = 0.f;
+    if (!UpdateRatePolicy.ShouldTick(UpdateRateState,
+                                     InDeltaSeconds,
+                                     SecondsSinceDisplayed,
+                                     0.f,
+                                     TickDeltaSeconds))
+    {
+        return;
+    }
+
+    if (URiveTickSubsystem* TickSubsystem = URiveTickSubsystem::Get())
+    {
+        TickSubsystem->QueueTick(this, this, TickDeltaSeconds);
+        return;
+    }
+
     if (bIsRendering)
     {
         if (GetArtboard())
         {
-            Artboard->Tick(InDeltaSeconds);
-            RiveRenderTarget->SubmitAndClear();
+            UpdateDrawInSlate();
+            Artboard->Tick(TickDeltaSeconds);
+            SubmitRenderCommands();
         }
     }
 #endif // WITH_RIVE
 }
 
+void URiveTextureObject::GatherArtboards(TArray<URiveArtboard*>& OutArtboards)
+{
+#if WITH_RIVE
+    if (bIsRendering && GetArtboard())
+    {
+        OutArtboards.Add(Artboard);
+    }
+#endif // WITH_RIVE
+}
+
+void URiveTextureObject::TickRender(float InDeltaSeconds)
+{
+#if WITH_RIVE
+    if (bIsRendering && GetArtboard())
+    {
+        UpdateDrawInSlate();
+        Artboard->Tick_Render(InDeltaSeconds);
+        SubmitRenderCommands();
+    }
+#endif // WITH_RIVE
+}
+
+bool URiveTextureObject::ShouldDrawInSlate() const
+{
+    return bDrawInSlate && Atlas == nullptr && FRiveSlateElement::IsSupported();
+}
+
+void URiveTextureObject::UpdateDrawInSlate()
+{
+    const bool bShouldDrawInSlate = ShouldDrawInSlate();
+    if (bShouldDrawInSlate == bIsDrawingInSlate)
+    {
+        return;
+    }
+
+    // Swap between a placeholder and a texture of the content size
+    const FIntPoint CurrentContentSize = GetContentSize();
+    bIsDrawingInSlate = bShouldDrawInSlate;
+    SlateRenderCommands.Empty();
+    bWasArtboardSettled = false;
+    ResizeOwnRenderTarget(CurrentContentSize);
+}
+
+void URiveTextureObject::SubmitRenderCommands()
+{
+#if WITH_RIVE
+    // The atlas page submits once for all of its slots
+    if (Atlas != nullptr)
+    {
+        return;
+    }
+
+    if (bIsDrawingInSlate)
+    {
+        SlateRenderCommands = RiveRenderTarget->TakeRenderCommands();
+
+        // The frame it settled on still differs from the previous one
+        const bool bIsArtboardSettled = Artboard->IsSettled();
+        if (!bIsArtboardSettled || !bWasArtboardSettled)
+        {
+            InvalidateDisplay();
+        }
+        bWasArtboardSettled = bIsArtboardSettled;
+        return;
+    }
+
+    RiveRenderTarget->SubmitAndClear();
+#endif // WITH_RIVE
+}
+
 #if WITH_EDITOR
 void URiveTextureObject::OnBeginPIE(bool bIsSimulating)
 {
@@ -106,8 +205,94 @@ void URiveTextureObject::OnBeginPIE(bool bIsSimulating)
 void URiveTextureObject::OnEndPIE(bool bIsSimulating) {}
 #endif
 
+void URiveTextureObject::ResizeRenderTargets(FIntPoint InNewSize)
+{
+    if (Atlas != nullptr)
+    {
+        if (UpdateAtlasSlot(InNewSize))
+        {
+            return;
+        }
+
+        // Too large for the atlas from now on, move to a render target of
+        // our own
+        if (IRiveRenderer* RiveRenderer =
+                IRiveRendererModule::Get().GetRenderer())
+        {
+            InitializeRenderTarget(RiveRenderer);
+            ResizeOwnRenderTarget(InNewSize);
+            RiveRenderTarget->Initialize();
+        }
+        return;
+    }
+
+    ResizeOwnRenderTarget(InNewSize);
+}
+
+void URiveTextureObject::ResizeOwnRenderTarget(const FIntPoint& InSize)
+{
+    InvalidateDisplay();
+
+    if (bIsDrawingInSlate)
+    {
+        // Our widget draws us in its window, the texture is never displayed
+        ContentSize = FIntPoint(FMath::Clamp(InSize.X,
+                                             RIVE_MIN_TEX_RESOLUTION,
+                                             RIVE_MAX_TEX_RESOLUTION),
+                                FMath::Clamp(InSize.Y,
+                                             RIVE_MIN_TEX_RESOLUTION,
+                                             RIVE_MAX_TEX_RESOLUTION));
+        Super::ResizeRenderTargets(
+            FIntPoint(RIVE_MIN_TEX_RESOLUTION, RIVE_MIN_TEX_RESOLUTION));
+        return;
+    }
+
+    if (!bBucketRenderTargetSize)
+    {
+        ContentSize = FIntPoint::ZeroValue;
+        Super::ResizeRenderTargets(InSize);
+        return;
+    }
+
+    ContentSize = FIntPoint(FMath::Clamp(InSize.X,
+                                         RIVE_MIN_TEX_RESOLUTION,
+                                         RIVE_MAX_TEX_RESOLUTION),
+                            FMath::Clamp(InSize.Y,
+                                         RIVE_MIN_TEX_RESOLUTION,
+                                         RIVE_MAX_TEX_RESOLUTION));
+    Super::ResizeRenderTargets(GetResizeBucketSize(ContentSize));
+}
+
+FIntPoint URiveTextureObject::GetContentSize() const
+{
+    return ContentSize == FIntPoint::ZeroValue ? Size : ContentSize;
+}
+
 FLinearColor URiveTextureObject::GetClearColor() const { return ClearColor; }
 
+URiveTexture* URiveTextureObject::GetDisplayTexture()
+{
+    if (Atlas != nullptr)
+    {
+        return Atlas;
+    }
+    return this;
+}
+
+FBox2f URiveTextureObject::GetDisplayUVRegion() const
+{
+    if (Atlas != nullptr)
+    {
+        return Atlas->GetSlotUVRegion(this);
+    }
+    if (ContentSize != FIntPoint::ZeroValue && Size.X > 0 && Size.Y > 0)
+    {
+        return FBox2f(FVector2f::ZeroVector,
+                      FVector2f(ContentSize) / FVector2f(Size));
+    }
+    return FBox2f(FVector2f::ZeroVector, FVector2f::UnitVector);
+}
+
 FVector2f URiveTextureObject::GetLocalCoordinate(URiveArtboard* InArtboard,
                                                  const FVector2f& InPosition)
 {
@@ -115,7 +300,7 @@ FVector2f URiveTextureObject::GetLocalCoordinate(URiveArtboard* InArtboard,
     if (InArtboard)
     {
         return InArtboard->GetLocalCoordinate(InPosition,
-                                              Size,
+                                              GetContentSize(),
                                               RiveDescriptor.Alignment,
                                               RiveDescriptor.FitType);
     }
@@ -133,7 +318,7 @@ FVector2f URiveTextureObject::GetLocalCoordinatesFromExtents(
         return GetArtboard()->GetLocalCoordinatesFromExtents(
             InPosition,
             InExtents,
-            Size,
+            GetContentSize(),
             RiveDescriptor.Alignment,
             RiveDescriptor.FitType);
     }
@@ -230,19 +415,20 @@ void URiveTextureObject::OnRiveFileInitialized(bool bSuccess)
         else
             Artboard->Reinitialize(true);
 
-        RiveRenderTarget.Reset();
-        RiveRenderTarget =
-            RiveRenderer->CreateTextureTarget_GameThread(GetFName(), this);
+        // Old commands point to the artboard we are about to replace
+        SlateRenderCommands.Empty();
+        bWasArtboardSettled = false;
+        InvalidateDisplay();
 
-        if (!OnResourceInitializedOnRenderThread.IsBoundToObject(this))
+        // The artboard size is only known once initialized, so the atlas slot
+        // is picked after Artboard->Initialize below
+        ReleaseAtlasSlot();
+        RiveRenderTarget.Reset();
+        if (!bUseSharedAtlas)
         {
-            OnResourceInitializedOnRenderThread.AddUObject(
-                this,
-                &URiveTextureObject::OnResourceInitialized_RenderThread);
+            InitializeRenderTarget(RiveRenderer);
         }
 
-        RiveRenderTarget->SetClearColor(ClearColor);
-
         if (RiveDescriptor.ArtboardName.IsEmpty())
         {
             Artboard->Initialize(RiveDescriptor.RiveFile,
@@ -261,30 +447,117 @@ void URiveTextureObject::OnRiveFileInitialized(bool bSuccess)
         RiveDescriptor.ArtboardName = Artboard->GetArtboardName();
         RiveDescriptor.StateMachineName = Artboard->StateMachineName;
 
-        if (Size == FIntPoint::ZeroValue)
+        const FIntPoint InitialSize =
+            GetContentSize() == FIntPoint::ZeroValue
+                ? FIntPoint(Artboard->GetSize().X, Artboard->GetSize().Y)
+                : GetContentSize();
+        if (bUseSharedAtlas && !UpdateAtlasSlot(InitialSize))
         {
-            ResizeRenderTargets(Artboard->GetSize());
+            InitializeRenderTarget(RiveRenderer);
         }
-        else
+        if (Atlas == nullptr)
         {
-            ResizeRenderTargets(Size);
+            bIsDrawingInSlate = ShouldDrawInSlate();
+            ResizeOwnRenderTarget(InitialSize);
         }
 
         InitializeAudioEngine();
 
-        Artboard->OnArtboardTick_Render.BindDynamic(
+        Artboard->OnArtboardTick_RenderNative.BindUObject(
             this,
             &URiveTextureObject::OnArtboardTickRender);
         Artboard->OnGetLocalCoordinate.BindDynamic(
             this,
             &URiveTextureObject::GetLocalCoordinate);
 
-        RiveRenderTarget->Initialize();
+        if (Atlas == nullptr)
+        {
+            RiveRenderTarget->Initialize();
+        }
         bIsRendering = true;
         OnRiveReady.Broadcast();
     }
 }
 
+void URiveTextureObject::InitializeRenderTarget(IRiveRenderer* InRiveRenderer)
+{
+    ReleaseAtlasSlot();
+
+    RiveRenderTarget =
+        InRiveRenderer->CreateTextureTarget_GameThread(GetFName(), this);
+
+    if (!OnResourceInitializedOnRenderThread.IsBoundToObject(this))
+    {
+        OnResourceInitializedOnRenderThread.AddUObject(
+            this,
+            &URiveTextureObject::OnResourceInitialized_RenderThread);
+    }
+
+    RiveRenderTarget->SetClearColor(ClearColor);
+
+    if (Artboard != nullptr)
+    {
+        Artboard->SetRenderTarget(RiveRenderTarget);
+    }
+}
+
+bool URiveTextureObject::UpdateAtlasSlot(const FIntPoint& InSize)
+{
+    URiveAtlasSubsystem* AtlasSubsystem = URiveAtlasSubsystem::Get();
+    if (AtlasSubsystem == nullptr)
+    {
+        return false;
+    }
+
+    URiveTextureAtlas* NewAtlas =
+        AtlasSubsystem->AcquireSlot(this, InSize, Atlas);
+    if (NewAtlas != Atlas)
+    {
+        Atlas = NewAtlas;
+        RiveRenderTarget = Atlas ? Atlas->GetRiveRenderTarget() : nullptr;
+        if (Artboard != nullptr)
+        {
+            Artboard->SetRenderTarget(RiveRenderTarget);
+        }
+    }
+
+    if (Atlas == nullptr)
+    {
+        return false;
+    }
+
+    InvalidateDisplay();
+
+    // We own no texture resources while in the atlas, Size only describes
+    // our slot
+    const FIntRect SlotRect = Atlas->GetSlotRect(this);
+    SizeX = Size.X = SlotRect.Width();
+    SizeY = Size.Y = SlotRect.Height();
+    ContentSize = FIntPoint::ZeroValue;
+    return true;
+}
+
+void URiveTextureObject::ReleaseAtlasSlot()
+{
+    if (Atlas == nullptr)
+    {
+        return;
+    }
+
+    if (URiveAtlasSubsystem* AtlasSubsystem = URiveAtlasSubsystem::Get())
+    {
+        AtlasSubsystem->ReleaseSlot(this, Atlas);
+    }
+
+    Atlas = nullptr;
+    RiveRenderTarget.Reset();
+    InvalidateDisplay();
+    if (Artboard != nullptr)
+    {
+        Artboard->SetRenderTarget(nullptr);
+    }
+}
+
 #if WITH_EDITOR
 void URiveTextureObject::PostEditChangeChainProperty(
     FPropertyChangedChainEvent& PropertyChangedEvent)
@@ -312,7 +585,8 @@ void URiveTextureObject::PostEditChangeChainProperty(
     else if (ActiveMemberNodeName ==
              GET_MEMBER_NAME_CHECKED(URiveTextureObject, ClearColor))
     {
-        if (RiveRenderTarget)
+        // Atlas pages are shared, their clear color stays transparent
+        if (RiveRenderTarget && Atlas == nullptr)
         {
             RiveRenderTarget->SetClearColor(ClearColor);
         }
@@ -331,6 +605,35 @@ void URiveTextureObject::PostEditChangeChainProperty(
 void URiveTextureObject::OnArtboardTickRender(float DeltaTime,
                                               URiveArtboard* InArtboard)
 {
+    if (Atlas != nullptr)
+    {
+        // Other slots share the render target, so keep our transform and
+        // whatever overflows our fit to ourselves
+        const FIntRect SlotRect = Atlas->GetSlotRect(this);
+        const FBox2f SlotBox(FVector2f(SlotRect.Min), FVector2f(SlotRect.Max));
+        RiveRenderTarget->Save();
+        RiveRenderTarget->ClipRect(SlotBox);
+        InArtboard->Align(
+            SlotBox,
+            RiveDescriptor.FitType,
+            RiveDescriptor.Alignment,
+            RiveDescriptor.ScaleFactor);
+        InArtboard->Draw();
+        RiveRenderTarget->Restore();
+        return;
+    }
+
+    if (ContentSize != FIntPoint::ZeroValue)
+    {
+        // Only the top left of a bucketed render target is displayed
+        InArtboard->Align(FBox2f(FVector2f::ZeroVector, FVector2f(ContentSize)),
+                          RiveDescriptor.FitType,
+                          RiveDescriptor.Alignment,
+                          RiveDescriptor.ScaleFactor);
+        InArtboard->Draw();
+        return;
+    }
+
     InArtboard->Align(RiveDescriptor.FitType,
                       RiveDescriptor.Alignment,
                       RiveDescriptor.ScaleFactor);
@@ -342,11 +645,7 @@ TArray<FString> URiveTextureObject::GetArtboardNamesForDropdown() const
     TArray<FString> Output;
     if (RiveDescriptor.RiveFile)
     {
-        for (URiveArtboard* DescriptorArtboard :
-             RiveDescriptor.RiveFile->Artboards)
-        {
-            Output.Add(DescriptorArtboard->GetArtboardName());
-        }
+        Output = RiveDescriptor.RiveFile->GetArtboardNamesForDropdown();
     }
 
     return Output;
@@ -357,15 +656,11 @@ TArray<FString> URiveTextureObject::GetStateMachineNamesForDropdown() const
     TArray<FString> Output{""};
     if (RiveDescriptor.RiveFile)
     {
-        for (URiveArtboard* RiveFileArtboard :
-             RiveDescriptor.RiveFile->Artboards)
-        {
-            if (RiveFileArtboard->GetArtboardName().Equals(
+        if (const FRiveArtboardInfo* ArtboardInfo =
+                RiveDescriptor.RiveFile->FindArtboardInfo(
                     RiveDescriptor.ArtboardName))
-            {
-                Output.Append(RiveFileArtboard->GetStateMachineNames());
-                break;
-            }
+        {
+            Output.Append(ArtboardInfo->GetStateMachineNames());
         }
     }
     return Output;
@@ -0,0 +1,237 @@
+// Copyright Rive, Inc. All rights reserved.
+
+#include "Rive/RiveTickSubsystem.h"
+
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "IRiveRenderer.h"
+#include "IRiveRendererModule.h"
+#include "Misc/CoreDelegates.h"
+#include "Rive/RiveArtboard.h"
+#include "Stats/RiveStats.h"
+
+static TAutoConsoleVariable<int32> CVarRiveTickCentralized(
+    TEXT("r.rive.tick.centralized"),
+    1,
+    TEXT("If non 0, Rive components and textures are ticked together by the "
+         "Rive tick subsystem instead of one after the other.\n")
+        TEXT("  0: every object ticks on its own\n")
+            TEXT("  1: ticked by the subsystem (default)"),
+    ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarRiveTickBudgetMs(
+    TEXT("r.rive.tick.budgetms"),
+    0.f,
+    TEXT("Game thread time in milliseconds Rive ticking may spend per frame. "
+         "Once spent, Low and Normal priority objects are deferred to the "
+         "next frame. 0 disables the budget."),
+    ECVF_Scalability);
+
+static TAutoConsoleVariable<int32> CVarRiveTickMaxDeferredFrames(
+    TEXT("r.rive.tick.maxdeferredframes"),
+    4,
+    TEXT("Number of frames in a row a Rive object can be deferred by "
+         "r.rive.tick.budgetms before it is ticked as High priority."),
+    ECVF_Scalability);
+
+namespace UE::Private::RiveTickSubsystem
+{
+// Clients advanced together before checking the budget again
+constexpr int32 ChunkSize = 32;
+} // namespace UE::Private::RiveTickSubsystem
+
+URiveTickSubsystem* URiveTickSubsystem::Get()
+{
+    if (GEngine == nullptr ||
+        CVarRiveTickCentralized.GetValueOnGameThread() == 0)
+    {
+        return nullptr;
+    }
+
+    return GEngine->GetEngineSubsystem<URiveTickSubsystem>();
+}
+
+void URiveTickSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    OnWorldTickEndHandle = FWorldDelegates::OnWorldTickEnd.AddUObject(
+        this,
+        &URiveTickSubsystem::OnWorldTickEnd);
+    OnEndFrameHandle =
+        FCoreDelegates::OnEndFrame.AddUObject(this,
+                                              &URiveTickSubsystem::OnEndFrame);
+}
+
+void URiveTickSubsystem::Deinitialize()
+{
+    PendingTicks.Empty();
+    PendingOwners.Empty();
+    DeferredTicks.Empty();
+
+    FWorldDelegates::OnWorldTickEnd.Remove(OnWorldTickEndHandle);
+    FCoreDelegates::OnEndFrame.Remove(OnEndFrameHandle);
+
+    Super::Deinitialize();
+}
+
+void URiveTickSubsystem::QueueTick(UObject* InOwner,
+                                   IRiveTickClient* InClient,
+                                   float InDeltaSeconds)
+{
+    check(IsInGameThread());
+    check(InOwner && InClient);
+
+    // The same object can be ticked by several worlds in the editor, only
+    // keep the first one
+    bool bIsAlreadyQueued = false;
+    PendingOwners.Add(InOwner, &bIsAlreadyQueued);
+    if (bIsAlreadyQueued)
+    {
+        return;
+    }
+
+    FPendingTick& Tick = PendingTicks.AddDefaulted_GetRef();
+    Tick.Owner = InOwner;
+    Tick.Client = InClient;
+    Tick.DeltaSeconds = InDeltaSeconds;
+    Tick.Priority = InClient->GetTickPriority();
+
+    // Objects deferred for too long jump the queue
+    if (FDeferredTick* Deferred = DeferredTicks.Find(InOwner))
+    {
+        Tick.DeltaSeconds += Deferred->DeltaSeconds;
+        if (Deferred->Frames >=
+            CVarRiveTickMaxDeferredFrames.GetValueOnGameThread())
+        {
+            Tick.Priority = ERiveTickPriority::High;
+        }
+    }
+}
+
+void URiveTickSubsystem::FlushPendingTicks()
+{
+    using namespace UE::Private::RiveTickSubsystem;
+
+    check(IsInGameThread());
+
+    if (PendingTicks.IsEmpty())
+    {
+        return;
+    }
+
+    SCOPED_NAMED_EVENT_TEXT("URiveTickSubsystem::FlushPendingTicks",
+                            FColor::White);
+    DECLARE_SCOPE_CYCLE_COUNTER(TEXT("RiveTickSubsystem::FlushPendingTicks"),
+                                STAT_RIVETICKSUBSYSTEM_FLUSH,
+                                STATGROUP_Rive);
+
+    // Clients may queue again while ticking, those go to the next flush
+    TArray<FPendingTick> Ticks = MoveTemp(PendingTicks);
+    PendingTicks.Reset();
+    PendingOwners.Reset();
+
+    Ticks.RemoveAll(
+        [](const FPendingTick& Tick) { return !Tick.Owner.IsValid(); });
+
+    // Highest priority first, and clients sharing a delta time next to each
+    // other so that their artboards advance in the same batch
+    Ticks.StableSort([](const FPendingTick& A, const FPendingTick& B) {
+        if (A.Priority != B.Priority)
+        {
+            return A.Priority > B.Priority;
+        }
+        return A.DeltaSeconds < B.DeltaSeconds;
+    });
+
+    INC_DWORD_STAT_BY(STAT_RiveTickClients, Ticks.Num());
+
+    const double BudgetSeconds =
+        FMath::Max(CVarRiveTickBudgetMs.GetValueOnGameThread(), 0.f) / 1000.0;
+    const double StartTime = FPlatformTime::Seconds();
+
+    TArray<URiveArtboard*> Artboards;
+    int32 Index = 0;
+    while (Index < Ticks.Num())
+    {
+        const ERiveTickPriority Priority = Ticks[Index].Priority;
+        if (BudgetSeconds > 0.0 && Priority != ERiveTickPriority::High &&
+            FPlatformTime::Seconds() - StartTime >= BudgetSeconds)
+        {
+            break;
+        }
+
+        // Advance a chunk of clients sharing priority and delta time at once
+        const float DeltaSeconds = Ticks[Index].DeltaSeconds;
+        int32 End = Index + 1;
+        while (End < Ticks.Num() && End - Index < ChunkSize &&
+               Ticks[End].Priority == Priority &&
+               Ticks[End].DeltaSeconds == DeltaSeconds)
+        {
+            ++End;
+        }
+
+        Artboards.Reset();
+        for (int32 TickIndex = Index; TickIndex < End; ++TickIndex)
+        {
+            Ticks[TickIndex].Client->GatherArtboards(Artboards);
+        }
+        URiveArtboard::AdvanceStateMachines(Artboards, DeltaSeconds);
+
+        for (int32 TickIndex = Index; TickIndex < End; ++TickIndex)
+        {
+            Ticks[TickIndex].Client->TickRender(DeltaSeconds);
+            DeferredTicks.Remove(Ticks[TickIndex].Owner.Get());
+        }
+
+        Index = End;
+    }
+
+    // Everything left is owed its delta time on the next frame
+    if (Index < Ticks.Num())
+    {
+        INC_DWORD_STAT(STAT_RiveTickBudgetOverruns);
+        INC_DWORD_STAT_BY(STAT_RiveTickDeferred, Ticks.Num() - Index);
+
+        // Forget objects destroyed while deferred
+        for (auto It = DeferredTicks.CreateIterator(); It; ++It)
+        {
+            if (It.Key().ResolveObjectPtr() == nullptr)
+            {
+                It.RemoveCurrent();
+            }
+        }
+
+        for (; Index < Ticks.Num(); ++Index)
+        {
+            FDeferredTick& Deferred =
+                DeferredTicks.FindOrAdd(Ticks[Index].Owner.Get());
+            Deferred.DeltaSeconds = Ticks[Index].DeltaSeconds;
+            ++Deferred.Frames;
+        }
+    }
+
+    // Make sure what we just submitted is rendered this frame, regardless of
+    // the order in which frame delegates run
+    if (IRiveRendererModule::IsAvailable())
+    {
+        if (IRiveRenderer* RiveRenderer =
+                IRiveRendererModule::Get().GetRenderer())
+        {
+            RiveRenderer->FlushPendingRenderTargets_GameThread();
+        }
+    }
+}
+
+void URiveTickSubsystem::OnWorldTickEnd(UWorld* InWorld,
+                                        ELevelTick InTickType,
+                                        float InDeltaSeconds)
+{
+    FlushPendingTicks();
+}
+
+void URiveTickSubsystem::OnEndFrame()
+{
+    // Catches objects ticked outside of a world tick, e.g. in the editor
+    FlushPendingTicks();
+}
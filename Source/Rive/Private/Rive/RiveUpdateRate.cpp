@@ -0,0 +1,71 @@
+// Copyright Rive, Inc. All rights reserved.
+
+#include "Rive/RiveUpdateRate.h"
+
+#include "Stats/RiveStats.h"
+
+static TAutoConsoleVariable<int32> CVarRiveUpdateRate(
+    TEXT("r.rive.updaterate"),
+    1,
+    TEXT("If non 0, Rive artboards follow the update rate policy of their "
+         "component or texture.\n")
+        TEXT("  0: always tick every frame\n")
+            TEXT("  1: reduce the rate of far artboards and pause the ones "
+                 "not rendered (default)"),
+    ECVF_Scalability);
+
+static TAutoConsoleVariable<float> CVarRiveUpdateRateDistanceScale(
+    TEXT("r.rive.updaterate.distancescale"),
+    1.f,
+    TEXT("Scales the distances of every Rive update rate policy. Lower values "
+         "reduce the rate of artboards closer to the view."),
+    ECVF_Scalability);
+
+bool FRiveUpdateRatePolicy::ShouldTick(FRiveUpdateRateState& InOutState,
+                                       float InDeltaSeconds,
+                                       float InSecondsSinceRendered,
+                                       float InDistance,
+                                       float& OutDeltaSeconds) const
+{
+    InOutState.AccumulatedSeconds += InDeltaSeconds;
+
+    if (bEnabled && CVarRiveUpdateRate.GetValueOnGameThread() != 0)
+    {
+        if (PauseWhenNotRenderedFor >= 0.f &&
+            InSecondsSinceRendered > PauseWhenNotRenderedFor)
+        {
+            // Time stands still while nobody is looking
+            InOutState.AccumulatedSeconds = 0.f;
+            INC_DWORD_STAT(STAT_RiveUpdateRatePaused);
+            return false;
+        }
+
+        const float DistanceScale =
+            FMath::Max(CVarRiveUpdateRateDistanceScale.GetValueOnGameThread(),
+                       0.f);
+        const float FullDistance = FullRateDistance * DistanceScale;
+        const float MinDistance =
+            FMath::Max(MinRateDistance * DistanceScale, FullDistance);
+
+        if (InDistance > FullDistance && MinRate > 0.f)
+        {
+            const float Alpha =
+                MinDistance > FullDistance
+                    ? FMath::Clamp((InDistance - FullDistance) /
+                                       (MinDistance - FullDistance),
+                                   0.f,
+                                   1.f)
+                    : 1.f;
+            const float Interval = Alpha / MinRate;
+            if (InOutState.AccumulatedSeconds < Interval)
+            {
+                INC_DWORD_STAT(STAT_RiveUpdateRateSkipped);
+                return false;
+            }
+        }
+    }
+
+    OutDeltaSeconds = InOutState.AccumulatedSeconds;
+    InOutState.AccumulatedSeconds = 0.f;
+    return true;
+}
@@ -0,0 +1,73 @@
+// Copyright Rive, Inc. All rights reserved.
+
+#include "RiveSlateElement.h"
+
+#include "IRiveRenderTarget.h"
+#include "Engine/RendererSettings.h"
+#include "Logs/RiveLog.h"
+
+static TAutoConsoleVariable<int32> CVarRiveSlateDirectDraw(
+    TEXT("r.rive.slate.directdraw"),
+    0,
+    TEXT("If non 0, Rive textures with bDrawInSlate are drawn straight into "
+         "the window by their widget instead of into a texture of their own. "
+         "Requires the RHI renderer and an R8G8B8A8 back buffer "
+         "(r.DefaultBackBufferPixelFormat) that allows unordered access, "
+         "falls back to textures otherwise."),
+    ECVF_Default);
+
+std::atomic<bool> FRiveSlateElement::bHasFailed{false};
+
+FRiveSlateElement::FRiveSlateElement(
+    const TSharedPtr<IRiveRenderTarget>& InRenderTarget,
+    TArray<FRiveRenderCommand>&& InRenderCommands) :
+    RenderTarget(InRenderTarget), RenderCommands(MoveTemp(InRenderCommands))
+{}
+
+bool FRiveSlateElement::IsSupported()
+{
+    // Swapchains are mostly B8G8R8A8 or 10 bit, which we can't draw into.
+    // Tell from the configured format once, rather than from a failed frame.
+    static const bool bIsBackBufferFormatSupported = []() {
+        const IConsoleVariable* CVarBackBufferFormat =
+            IConsoleManager::Get().FindConsoleVariable(
+                TEXT("r.DefaultBackBufferPixelFormat"));
+        return CVarBackBufferFormat &&
+               FDefaultBackBufferPixelFormat::Convert2PixelFormat(
+                   FDefaultBackBufferPixelFormat::FromInt(
+                       CVarBackBufferFormat->GetInt())) == PF_R8G8B8A8;
+    }();
+
+    return CVarRiveSlateDirectDraw.GetValueOnGameThread() != 0 &&
+           bIsBackBufferFormatSupported &&
+           !bHasFailed.load(std::memory_order_relaxed);
+}
+
+PRAGMA_DISABLE_DEPRECATION_WARNINGS
+void FRiveSlateElement::Draw_RenderThread(FRHICommandListImmediate& RHICmdList,
+                                          const void* InWindowBackBuffer)
+{
+#if WITH_RIVE
+    if (!RenderTarget || InWindowBackBuffer == nullptr)
+    {
+        return;
+    }
+
+    const FTextureRHIRef& BackBuffer =
+        *static_cast<const FTextureRHIRef*>(InWindowBackBuffer);
+    if (!RenderTarget->DrawInto_RenderThread(RHICmdList,
+                                             BackBuffer,
+                                             RenderCommands) &&
+        !bHasFailed.exchange(true))
+    {
+        UE_LOG(LogRive,
+               Warning,
+               TEXT("Rive can't draw into this window's back buffer (%s), "
+                    "Rive widgets go back to drawing into textures."),
+               BackBuffer.IsValid()
+                   ? GetPixelFormatString(BackBuffer->GetFormat())
+                   : TEXT("none"));
+    }
+#endif // WITH_RIVE
+}
+PRAGMA_ENABLE_DEPRECATION_WARNINGS
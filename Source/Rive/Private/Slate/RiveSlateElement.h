@@ -0,0 +1,60 @@
+// Copyright Rive, Inc. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "RiveRenderCommand.h"
+#include "Rendering/RenderingCommon.h"
+
+#include <atomic>
+
+class IRiveRenderTarget;
+
+/**
+ * Custom Slate element drawing Rive render commands straight into the window
+ * back buffer during the Slate render pass, in between the surrounding
+ * widgets, instead of sampling a texture the artboard was drawn into first.
+ * Created for every paint, it owns its copy of the commands.
+ */
+class FRiveSlateElement : public ICustomSlateElement
+{
+    /**
+     * Structor(s)
+     */
+
+public:
+    FRiveSlateElement(const TSharedPtr<IRiveRenderTarget>& InRenderTarget,
+                      TArray<FRiveRenderCommand>&& InRenderCommands);
+
+    /**
+     * Implementation(s)
+     */
+
+public:
+    /**
+     * Whether drawing in Slate is enabled (r.rive.slate.directdraw), the
+     * configured back buffer format is one we can draw into, and drawing has
+     * not failed yet. Once a back buffer can't be drawn into, widgets go back
+     * to textures for good.
+     */
+    static bool IsSupported();
+
+    //~ BEGIN : ICustomSlateElement Interface
+
+    PRAGMA_DISABLE_DEPRECATION_WARNINGS
+    virtual void Draw_RenderThread(FRHICommandListImmediate& RHICmdList,
+                                   const void* InWindowBackBuffer) override;
+    PRAGMA_ENABLE_DEPRECATION_WARNINGS
+
+    //~ END : ICustomSlateElement Interface
+
+    /**
+     * Attribute(s)
+     */
+
+private:
+    TSharedPtr<IRiveRenderTarget> RenderTarget;
+    TArray<FRiveRenderCommand> RenderCommands;
+
+    static std::atomic<bool> bHasFailed;
+};
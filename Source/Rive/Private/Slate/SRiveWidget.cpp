@@ -5,6 +5,8 @@
 #include "Engine/World.h"
 #include "ImageUtils.h"
 #include "Rive/RiveTextureObject.h"
+#include "Slate/RiveSlateElement.h"
+#include "Stats/RiveStats.h"
 #include "TimerManager.h"
 #include "Widgets/Images/SImage.h"
 #include "Widgets/SOverlay.h"
@@ -13,6 +15,16 @@
 #include "TextureEditorSettings.h"
 #endif
 
+static TAutoConsoleVariable<int32> CVarRiveSlateInvalidation(
+    TEXT("r.rive.slate.invalidation"),
+    1,
+    TEXT("If non 0, Rive widgets only invalidate their paint when their "
+         "content changed, so invalidation panels can reuse their cached "
+         "draw elements the rest of the time.\n")
+        TEXT("  0: repaint every frame\n")
+            TEXT("  1: repaint on new content (default)"),
+    ECVF_Default);
+
 namespace UE::Private::SRiveWidget
 {
 FSlateBrush* CreateTransparentBrush()
@@ -101,16 +113,172 @@ void SRiveWidget::SetRiveTexture(URiveTexture* InRiveTexture)
             RiveTextureBrush->DrawAs = ESlateBrushDrawType::Image;
             RiveTextureBrush->TintColor = FSlateColor(FLinearColor::White);
             RiveTextureBrush->SetResourceObject(RiveTexture);
+            UpdateBrushFromAtlas();
             RiveImageView->SetImage(RiveTextureBrush.Get());
-            InRiveTexture->ResizeRenderTargets(
-                FIntPoint(PreviousSize.X, PreviousSize.Y));
+            if (bResizesTexture)
+            {
+                InRiveTexture->ResizeRenderTargets(
+                    FIntPoint(PreviousSize.X, PreviousSize.Y));
+            }
+        }
+
+        Invalidate(EInvalidateWidgetReason::Paint);
+    }
+}
+
+void SRiveWidget::Tick(const FGeometry& AllottedGeometry,
+                       const double InCurrentTime,
+                       const float InDeltaTime)
+{
+    SCompoundWidget::Tick(AllottedGeometry, InCurrentTime, InDeltaTime);
+
+    // Slate only ticks widgets that are visible, unlike OnPaint this keeps
+    // being called under an invalidation panel
+    if (URiveTextureObject* RiveTextureObject =
+            Cast<URiveTextureObject>(RiveTexture))
+    {
+        RiveTextureObject->MarkDisplayed();
+
+        // Slate doesn't know when our brush or Slate commands change, frames
+        // drawn into the same texture show up without repainting though
+        if (RiveTextureObject->GetDisplayVersion() != PaintedDisplayVersion ||
+            CVarRiveSlateInvalidation.GetValueOnGameThread() == 0)
+        {
+            Invalidate(EInvalidateWidgetReason::Paint);
+            INC_DWORD_STAT(STAT_RiveWidgetPaintInvalidations);
         }
     }
 }
 
+int32 SRiveWidget::OnPaint(const FPaintArgs& Args,
+                           const FGeometry& AllottedGeometry,
+                           const FSlateRect& MyCullingRect,
+                           FSlateWindowElementList& OutDrawElements,
+                           int32 LayerId,
+                           const FWidgetStyle& InWidgetStyle,
+                           bool bParentEnabled) const
+{
+    SCOPE_CYCLE_COUNTER(STAT_RiveWidgetPaint);
+
+    // Atlas slots move when the atlas is repacked, so the brush is refreshed
+    // right before drawing
+    UpdateBrushFromAtlas();
+
+    const int32 MaxLayerId = SCompoundWidget::OnPaint(Args,
+                                                      AllottedGeometry,
+                                                      MyCullingRect,
+                                                      OutDrawElements,
+                                                      LayerId,
+                                                      InWidgetStyle,
+                                                      bParentEnabled);
+
+    const URiveTextureObject* RiveTextureObject =
+        Cast<URiveTextureObject>(RiveTexture);
+    if (RiveTextureObject)
+    {
+        PaintedDisplayVersion = RiveTextureObject->GetDisplayVersion();
+    }
+
+    if (RiveTextureObject && RiveTextureObject->IsDrawingInSlate())
+    {
+        return PaintInSlate(AllottedGeometry,
+                            MyCullingRect,
+                            OutDrawElements,
+                            MaxLayerId);
+    }
+
+    return MaxLayerId;
+}
+
+int32 SRiveWidget::PaintInSlate(const FGeometry& AllottedGeometry,
+                                const FSlateRect& MyCullingRect,
+                                FSlateWindowElementList& OutDrawElements,
+                                int32 LayerId) const
+{
+#if WITH_RIVE
+    const URiveTextureObject* RiveTextureObject =
+        CastChecked<URiveTextureObject>(RiveTexture);
+    const TArray<FRiveRenderCommand>& ArtboardCommands =
+        RiveTextureObject->GetSlateRenderCommands();
+    const FIntPoint ContentSize = RiveTextureObject->GetContentSize();
+    if (ArtboardCommands.IsEmpty() || ContentSize.X <= 0 || ContentSize.Y <= 0)
+    {
+        return LayerId;
+    }
+
+    // Paint geometry and culling rects are relative to the window already,
+    // like the back buffer we draw into
+    TArray<FRiveRenderCommand> Commands;
+    Commands.Reserve(ArtboardCommands.Num() + 4);
+    Commands.Emplace(ERiveRenderCommandType::Save);
+
+    FRiveRenderCommand& ClipCommand =
+        Commands.Emplace_GetRef(ERiveRenderCommandType::ClipPath);
+    ClipCommand.TX = MyCullingRect.Left;
+    ClipCommand.TY = MyCullingRect.Top;
+    ClipCommand.X2 = MyCullingRect.Right;
+    ClipCommand.Y2 = MyCullingRect.Bottom;
+
+    // The artboard is laid out in our content size, map it onto our geometry,
+    // render transforms included
+    const FVector2f ContentScale =
+        FVector2f(AllottedGeometry.GetLocalSize()) / FVector2f(ContentSize);
+    const FSlateRenderTransform ContentToWindow =
+        FSlateRenderTransform(FScale2f(ContentScale))
+            .Concatenate(AllottedGeometry.GetAccumulatedRenderTransform());
+
+    FRiveRenderCommand& TransformCommand =
+        Commands.Emplace_GetRef(ERiveRenderCommandType::Transform);
+    ContentToWindow.GetMatrix().GetMatrix(TransformCommand.X,
+                                          TransformCommand.Y,
+                                          TransformCommand.X2,
+                                          TransformCommand.Y2);
+    TransformCommand.TX = ContentToWindow.GetTranslation().X;
+    TransformCommand.TY = ContentToWindow.GetTranslation().Y;
+
+    Commands.Append(ArtboardCommands);
+    Commands.Emplace(ERiveRenderCommandType::Restore);
+
+    FSlateDrawElement::MakeCustom(
+        OutDrawElements,
+        LayerId + 1,
+        MakeShared<FRiveSlateElement, ESPMode::ThreadSafe>(
+            RiveTextureObject->GetRiveRenderTarget(),
+            MoveTemp(Commands)));
+    INC_DWORD_STAT(STAT_RiveSlateDirectDraws);
+
+    return LayerId + 1;
+#else
+    return LayerId;
+#endif // WITH_RIVE
+}
+
+void SRiveWidget::UpdateBrushFromAtlas() const
+{
+    URiveTextureObject* RiveTextureObject =
+        Cast<URiveTextureObject>(RiveTexture);
+    if (!RiveTextureBrush || !RiveTextureObject)
+    {
+        return;
+    }
+
+    // Drawn in Slate instead, our texture is only a placeholder
+    RiveTextureBrush->DrawAs = RiveTextureObject->IsDrawingInSlate()
+                                   ? ESlateBrushDrawType::NoDrawType
+                                   : ESlateBrushDrawType::Image;
+
+    UObject* DisplayTexture = RiveTextureObject->GetDisplayTexture();
+    if (RiveTextureBrush->GetResourceObject() != DisplayTexture)
+    {
+        RiveTextureBrush->SetResourceObject(DisplayTexture);
+    }
+
+    RiveTextureBrush->SetUVRegion(RiveTextureObject->GetDisplayUVRegion());
+}
+
 void SRiveWidget::OnResize() const
 {
-    if (RiveTextureBrush && RiveTexture)
+    if (RiveTextureBrush && RiveTexture && bResizesTexture)
     {
         RiveTexture->ResizeRenderTargets(
             FIntPoint(PreviousSize.X, PreviousSize.Y));
@@ -1,3 +1,37 @@
 // Copyright Rive, Inc. All rights reserved.
 
 #include "RiveStats.h"
+
+DEFINE_STAT(STAT_RiveAtlasPages);
+DEFINE_STAT(STAT_RiveAtlasMemory);
+DEFINE_STAT(STAT_RiveBatchAdvancedArtboards);
+DEFINE_STAT(STAT_RiveTickClients);
+DEFINE_STAT(STAT_RiveTickBudgetOverruns);
+DEFINE_STAT(STAT_RiveTickDeferred);
+DEFINE_STAT(STAT_RiveUpdateRateSkipped);
+DEFINE_STAT(STAT_RiveUpdateRatePaused);
+DEFINE_STAT(STAT_RiveAutoResolutionChanges);
+DEFINE_STAT(STAT_RiveSlateDirectDraws);
+DEFINE_STAT(STAT_RiveWidgetPaintInvalidations);
+DEFINE_STAT(STAT_RiveWidgetPaint);
+DEFINE_STAT(STAT_RiveInstancedArtboards);
+DEFINE_STAT(STAT_RiveInstancedSharedDraws);
+DEFINE_STAT(STAT_RiveInstancedDedupRatio);
+DEFINE_STAT(STAT_RivePooledArtboards);
+DEFINE_STAT(STAT_RiveArtboardPoolCreate);
+DEFINE_STAT(STAT_RiveFileImport);
+DEFINE_STAT(STAT_RiveFileImportCompletion);
+DEFINE_STAT(STAT_RivePendingImportCompletions);
+DEFINE_STAT(STAT_RiveAssetDecode);
+DEFINE_STAT(STAT_RiveParallelAssetDecodes);
+DEFINE_STAT(STAT_RiveBuildArtboardInfos);
+DEFINE_STAT(STAT_RiveFileDataLoad);
+DEFINE_STAT(STAT_RiveAssetCacheEntries);
+DEFINE_STAT(STAT_RiveAssetCacheHits);
+DEFINE_STAT(STAT_RiveAssetCacheMisses);
+DEFINE_STAT(STAT_RiveAssetCacheMemory);
+DEFINE_STAT(STAT_RiveAssetCacheDedupMemory);
+DEFINE_STAT(STAT_RiveTextShaping);
+DEFINE_STAT(STAT_RiveTextShapeCacheHits);
+DEFINE_STAT(STAT_RiveTextShapeCacheMisses);
+DEFINE_STAT(STAT_RivePrewarmArtboard);
@@ -5,3 +5,103 @@
 #include "Stats/Stats.h"
 
 DECLARE_STATS_GROUP(TEXT("Rive"), STATGROUP_Rive, STATCAT_Advanced);
+
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Atlas Pages"),
+                                      STAT_RiveAtlasPages,
+                                      STATGROUP_Rive, );
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Atlas Memory"),
+                           STAT_RiveAtlasMemory,
+                           STATGROUP_Rive, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Artboards Advanced In Batch"),
+                                  STAT_RiveBatchAdvancedArtboards,
+                                  STATGROUP_Rive, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Tick Clients"),
+                                  STAT_RiveTickClients,
+                                  STATGROUP_Rive, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Tick Budget Overruns"),
+                                  STAT_RiveTickBudgetOverruns,
+                                  STATGROUP_Rive, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Tick Deferred Clients"),
+                                  STAT_RiveTickDeferred,
+                                  STATGROUP_Rive, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Update Rate Skipped Ticks"),
+                                  STAT_RiveUpdateRateSkipped,
+                                  STATGROUP_Rive, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Update Rate Paused Ticks"),
+                                  STAT_RiveUpdateRatePaused,
+                                  STATGROUP_Rive, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Auto Resolution Changes"),
+                                  STAT_RiveAutoResolutionChanges,
+                                  STATGROUP_Rive, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Slate Direct Draws"),
+                                  STAT_RiveSlateDirectDraws,
+                                  STATGROUP_Rive, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Widget Paint Invalidations"),
+                                  STAT_RiveWidgetPaintInvalidations,
+                                  STATGROUP_Rive, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Widget Paint"),
+                          STAT_RiveWidgetPaint,
+                          STATGROUP_Rive, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Instanced Artboards"),
+                                      STAT_RiveInstancedArtboards,
+                                      STATGROUP_Rive, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Instanced Shared Draws"),
+                                  STAT_RiveInstancedSharedDraws,
+                                  STATGROUP_Rive, );
+DECLARE_FLOAT_ACCUMULATOR_STAT_EXTERN(TEXT("Instanced Dedup Ratio (%)"),
+                                      STAT_RiveInstancedDedupRatio,
+                                      STATGROUP_Rive, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Pooled Artboards"),
+                                      STAT_RivePooledArtboards,
+                                      STATGROUP_Rive, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Artboard Pool Create"),
+                          STAT_RiveArtboardPoolCreate,
+                          STATGROUP_Rive, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("File Import"),
+                          STAT_RiveFileImport,
+                          STATGROUP_Rive, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("File Import Completion"),
+                          STAT_RiveFileImportCompletion,
+                          STATGROUP_Rive, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Pending Import Completions"),
+                                      STAT_RivePendingImportCompletions,
+                                      STATGROUP_Rive, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Asset Decode"),
+                          STAT_RiveAssetDecode,
+                          STATGROUP_Rive, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Parallel Asset Decodes"),
+                                  STAT_RiveParallelAssetDecodes,
+                                  STATGROUP_Rive, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Build Artboard Infos"),
+                          STAT_RiveBuildArtboardInfos,
+                          STATGROUP_Rive, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("File Data Load"),
+                          STAT_RiveFileDataLoad,
+                          STATGROUP_Rive, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Asset Cache Entries"),
+                                      STAT_RiveAssetCacheEntries,
+                                      STATGROUP_Rive, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Asset Cache Hits"),
+                                      STAT_RiveAssetCacheHits,
+                                      STATGROUP_Rive, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Asset Cache Misses"),
+                                      STAT_RiveAssetCacheMisses,
+                                      STATGROUP_Rive, );
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Asset Cache Memory"),
+                           STAT_RiveAssetCacheMemory,
+                           STATGROUP_Rive, );
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Asset Cache Deduplicated Memory"),
+                           STAT_RiveAssetCacheDedupMemory,
+                           STATGROUP_Rive, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Text Shaping"),
+                          STAT_RiveTextShaping,
+                          STATGROUP_Rive, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Text Shape Cache Hits"),
+                                  STAT_RiveTextShapeCacheHits,
+                                  STATGROUP_Rive, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Text Shape Cache Misses"),
+                                  STAT_RiveTextShapeCacheMisses,
+                                  STATGROUP_Rive, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Prewarm Artboard"),
+                          STAT_RivePrewarmArtboard,
+                          STATGROUP_Rive, );
@@ -92,11 +92,13 @@ URiveWidget::~URiveWidget()
 
     RiveWidget.Reset();
 
-    if (RiveTextureObject != nullptr)
+    // Shared texture objects may already be gone, and drop our dynamic
+    // binding by themselves
+    if (RiveTextureObject != nullptr && bOwnsTextureObject)
     {
         RiveTextureObject->MarkAsGarbage();
-        RiveTextureObject = nullptr;
     }
+    RiveTextureObject = nullptr;
 }
 
 #if WITH_EDITOR
@@ -118,12 +120,7 @@ void URiveWidget::ReleaseSlateResources(bool bReleaseChildren)
     }
 
     RiveWidget.Reset();
-
-    if (RiveTextureObject != nullptr)
-    {
-        RiveTextureObject->MarkAsGarbage();
-        RiveTextureObject = nullptr;
-    }
+    ReleaseTextureObject();
 }
 
 TSharedRef<SWidget> URiveWidget::RebuildWidget()
@@ -134,25 +131,83 @@ TSharedRef<SWidget> URiveWidget::RebuildWidget()
                                                  OnSWidgetSizeChanged));
 
     if (!RiveTextureObject && RiveWidget.IsValid())
+    {
+        CreateTextureObject();
+    }
+
+    return RiveWidget.ToSharedRef();
+}
+
+void URiveWidget::CreateTextureObject()
+{
+    bOwnsTextureObject = SharedTextureObject == nullptr;
+    RiveWidget->SetResizesTexture(bOwnsTextureObject);
+
+    if (bOwnsTextureObject)
     {
         RiveTextureObject = NewObject<URiveTextureObject>();
         RiveTextureObject->Size =
             FIntPoint::ZeroValue; // Setting to zero value here will make the
                                   // rive texture use the artboard size
                                   // initially
+        RiveTextureObject->bUseSharedAtlas = bUseSharedAtlas;
+        // Widgets are resized continuously while animating or dragging
+        // splitters, and display us through GetDisplayUVRegion
+        RiveTextureObject->bBucketRenderTargetSize = true;
+    }
+    else
+    {
+        RiveTextureObject = SharedTextureObject;
+    }
 
-        if (UWorld* World = GetWorld())
-        {
-            World->GetTimerManager().ClearTimer(TimerHandle);
-            World->GetTimerManager().SetTimer(
-                TimerHandle,
-                [this]() { Setup(); },
-                0.05f,
-                false);
-        }
+    if (UWorld* World = GetWorld())
+    {
+        World->GetTimerManager().ClearTimer(TimerHandle);
+        World->GetTimerManager().SetTimer(
+            TimerHandle,
+            [this]() { Setup(); },
+            0.05f,
+            false);
     }
+}
 
-    return RiveWidget.ToSharedRef();
+void URiveWidget::ReleaseTextureObject()
+{
+    if (RiveTextureObject == nullptr)
+    {
+        return;
+    }
+
+    if (bOwnsTextureObject)
+    {
+        RiveTextureObject->MarkAsGarbage();
+    }
+    else
+    {
+        // Others keep using it
+        RiveTextureObject->OnRiveReady.RemoveDynamic(
+            this,
+            &URiveWidget::OnRiveObjectReady);
+    }
+    RiveTextureObject = nullptr;
+}
+
+void URiveWidget::SetSharedTextureObject(URiveTextureObject* InTextureObject)
+{
+    if (SharedTextureObject == InTextureObject)
+    {
+        return;
+    }
+
+    SharedTextureObject = InTextureObject;
+
+    // Otherwise picked up once our Slate widget is built
+    if (RiveWidget.IsValid())
+    {
+        RiveWidget->SetRiveTexture(nullptr);
+        ReleaseTextureObject();
+        CreateTextureObject();
+    }
 }
 
 FReply URiveWidget::NativeOnMouseButtonDown(const FGeometry& InGeometry,
@@ -301,10 +356,7 @@ TArray<FString> URiveWidget::GetArtboardNamesForDropdown() const
 
     if (RiveDescriptor.RiveFile)
     {
-        for (URiveArtboard* Artboard : RiveDescriptor.RiveFile->Artboards)
-        {
-            Output.Add(Artboard->GetArtboardName());
-        }
+        Output = RiveDescriptor.RiveFile->GetArtboardNamesForDropdown();
     }
 
     return Output;
@@ -315,13 +367,11 @@ TArray<FString> URiveWidget::GetStateMachineNamesForDropdown() const
     TArray<FString> Output{""};
     if (RiveDescriptor.RiveFile)
     {
-        for (URiveArtboard* Artboard : RiveDescriptor.RiveFile->Artboards)
+        if (const FRiveArtboardInfo* ArtboardInfo =
+                RiveDescriptor.RiveFile->FindArtboardInfo(
+                    RiveDescriptor.ArtboardName))
         {
-            if (Artboard->GetArtboardName().Equals(RiveDescriptor.ArtboardName))
-            {
-                Output.Append(Artboard->GetStateMachineNames());
-                break;
-            }
+            Output.Append(ArtboardInfo->GetStateMachineNames());
         }
     }
 
@@ -375,6 +425,22 @@ void URiveWidget::Setup()
         return;
     }
 
+    if (!bOwnsTextureObject)
+    {
+        // Initialized by its owner, possibly already
+        if (RiveTextureObject->bIsRendering && RiveTextureObject->GetArtboard())
+        {
+            OnRiveObjectReady();
+        }
+        else
+        {
+            RiveTextureObject->OnRiveReady.AddUniqueDynamic(
+                this,
+                &URiveWidget::OnRiveObjectReady);
+        }
+        return;
+    }
+
     RiveTextureObject->OnRiveReady.AddDynamic(this,
                                               &URiveWidget::OnRiveObjectReady);
 #if WITH_EDITOR
@@ -397,6 +463,12 @@ void URiveWidget::SetRiveDescriptor(const FRiveDescriptor& newDescriptor)
 
 void URiveWidget::CheckArtboardSize()
 {
+    // The size of a shared artboard is up to its owner
+    if (!bOwnsTextureObject)
+    {
+        return;
+    }
+
     URiveArtboard* Artboard = GetArtboard();
 
     FVector2D WidgetSize = RiveWidget->GetSize();
@@ -7,9 +7,12 @@
 #include "Components/ActorComponent.h"
 #include "Rive/RiveArtboard.h"
 #include "Rive/RiveDescriptor.h"
+#include "Rive/RiveTickSubsystem.h"
+#include "Rive/RiveUpdateRate.h"
 #include "RiveActorComponent.generated.h"
 
 class IRiveRenderer;
+class UPrimitiveComponent;
 class URiveAudioEngine;
 class URiveTexture;
 class URiveArtboard;
@@ -18,7 +21,8 @@ class URiveFile;
 UCLASS(ClassGroup = (Rive),
        Meta = (BlueprintSpawnableComponent),
        DisplayName = Rive)
-class RIVE_API URiveActorComponent : public UActorComponent
+class RIVE_API URiveActorComponent : public UActorComponent,
+                                     public IRiveTickClient
 {
     DECLARE_DYNAMIC_MULTICAST_DELEGATE(FRiveReadyDelegate);
 
@@ -47,6 +51,21 @@ public:
 
     //~ END : UActorComponent Interface
 
+    //~ BEGIN : IRiveTickClient Interface
+
+public:
+    virtual void GatherArtboards(
+        TArray<URiveArtboard*>& OutArtboards) override;
+
+    virtual void TickRender(float InDeltaSeconds) override;
+
+    virtual ERiveTickPriority GetTickPriority() const override
+    {
+        return TickPriority;
+    }
+
+    //~ END : IRiveTickClient Interface
+
     void Initialize();
 
     UPROPERTY(BlueprintAssignable, Category = Rive)
@@ -84,7 +103,7 @@ public:
         FPropertyChangedChainEvent& PropertyChangedEvent) override;
 #endif
 protected:
-    void RiveReady(IRiveRenderer* InRiveRenderer);
+    virtual void RiveReady(IRiveRenderer* InRiveRenderer);
     void OnResourceInitialized_RenderThread(
         FRHICommandListImmediate& RHICmdList,
         FTextureRHIRef& NewResource);
@@ -112,11 +131,90 @@ public:
     UPROPERTY(BlueprintReadWrite, Transient, Category = Rive)
     TObjectPtr<URiveAudioEngine> RiveAudioEngine;
 
+    /**
+     * Whether the Rive tick subsystem can defer us when over its per frame
+     * budget (r.rive.tick.budgetms)
+     */
+    UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Rive)
+    ERiveTickPriority TickPriority = ERiveTickPriority::Normal;
+
+    /** Lowers how often our artboards tick when far away or not rendered */
+    UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Rive)
+    FRiveUpdateRatePolicy UpdateRatePolicy;
+
+    /**
+     * Picks the render target resolution from the size of our mesh on screen
+     * instead of using Size. The default artboard is still laid out in Size
+     * and scaled to the picked resolution, artboards added with AddArtboard
+     * lay themselves out in the render target.
+     */
+    UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Rive)
+    bool bAutoResolution = false;
+
+    /** Smallest longest side of the render target, in pixels */
+    UPROPERTY(BlueprintReadWrite,
+              EditAnywhere,
+              Category = Rive,
+              meta = (EditCondition = "bAutoResolution",
+                      ClampMin = 1,
+                      UIMin = 1,
+                      ClampMax = 3840,
+                      UIMax = 3840))
+    int32 MinAutoResolution = 64;
+
+    /** Largest longest side of the render target, in pixels */
+    UPROPERTY(BlueprintReadWrite,
+              EditAnywhere,
+              Category = Rive,
+              meta = (EditCondition = "bAutoResolution",
+                      ClampMin = 1,
+                      UIMin = 1,
+                      ClampMax = 3840,
+                      UIMax = 3840))
+    int32 MaxAutoResolution = 2048;
+
+    /**
+     * Number of times the texture repeats along the longest side of the mesh
+     * showing it, as set up by its material UVs
+     */
+    UPROPERTY(BlueprintReadWrite,
+              EditAnywhere,
+              Category = Rive,
+              meta = (EditCondition = "bAutoResolution",
+                      ClampMin = 0.01,
+                      UIMin = 0.01))
+    float AutoResolutionUVScale = 1.f;
+
+    /**
+     * How far past the current resolution, as a fraction of it, the size on
+     * screen has to go before we switch, so that we don't reallocate back and
+     * forth around a threshold
+     */
+    UPROPERTY(BlueprintReadWrite,
+              EditAnywhere,
+              Category = Rive,
+              meta = (EditCondition = "bAutoResolution",
+                      ClampMin = 0,
+                      UIMin = 0,
+                      ClampMax = 1,
+                      UIMax = 1))
+    float AutoResolutionHysteresis = 0.25f;
+
 private:
-    UFUNCTION()
     void OnDefaultArtboardTickRender(float DeltaTime,
                                      URiveArtboard* InArtboard);
 
+    /** Size of the render target, Size or the one picked by bAutoResolution */
+    FIntPoint GetRenderTargetSize() const;
+
+    void UpdateAutoResolution();
+
+    /**
+     * Length in pixels of our mesh on screen for the first local player, 0 if
+     * there is no such view
+     */
+    float GetProjectedScreenSize();
+
     UFUNCTION()
     TArray<FString> GetArtboardNamesForDropdown() const;
 
@@ -126,4 +224,12 @@ private:
     void InitializeAudioEngine();
     FDelegateHandle AudioEngineLambdaHandle;
     TSharedPtr<IRiveRenderTarget> RiveRenderTarget;
+    FRiveUpdateRateState UpdateRateState;
+
+    /** Longest side picked by bAutoResolution, 0 until the first pick */
+    int32 AutoResolution = 0;
+
+    /** Primitive whose material samples RiveTexture */
+    TWeakObjectPtr<UPrimitiveComponent> DisplayPrimitive;
+    double NextDisplayPrimitiveSearchTime = 0.0;
 };
@@ -0,0 +1,260 @@
+// Copyright Rive, Inc. All rights reserved.
+
+#pragma once
+
+#include "IRiveRenderTarget.h"
+#include "Components/ActorComponent.h"
+#include "Engine/EngineTypes.h"
+#include "Rive/RiveArtboardPool.h"
+#include "Rive/RiveDescriptor.h"
+#include "Rive/RiveTickSubsystem.h"
+#include "Rive/RiveUpdateRate.h"
+#include "RiveInstancedComponent.generated.h"
+
+class IRiveRenderer;
+class UInstancedStaticMeshComponent;
+class FRiveStateMachine;
+class UMaterialInstanceDynamic;
+class URiveArtboard;
+class URiveTexture;
+
+/**
+ * Draws many instances of the same artboard, such as health bars or
+ * nameplates over a crowd, into the tiles of a single atlas texture. Every
+ * instance has its own state machine, all of them advance together and are
+ * drawn with a single submit per frame.
+ *
+ * The atlas is bound to a material of an instanced static mesh, which picks
+ * each instance's tile from its per instance custom data. The material
+ * computes its UVs as (Tile % Columns + UV.x, floor(Tile / Columns) + UV.y)
+ * / (Columns, Rows), with the tile count passed in as scalar parameters.
+ * Other users, e.g. Niagara sprites, can use GetTileUVRegion.
+ *
+ * Settled instances whose inputs hold the same values look the same, so only
+ * the first of them is drawn and the others show its tile instead
+ * (r.rive.instanced.dedup).
+ */
+UCLASS(ClassGroup = (Rive),
+       Meta = (BlueprintSpawnableComponent),
+       DisplayName = "Rive Instanced")
+class RIVE_API URiveInstancedComponent : public UActorComponent,
+                                         public IRiveTickClient
+{
+    GENERATED_BODY()
+
+    DECLARE_DYNAMIC_MULTICAST_DELEGATE(FRiveReadyDelegate);
+
+    /**
+     * Structor(s)
+     */
+
+public:
+    URiveInstancedComponent();
+
+    //~ BEGIN : UActorComponent Interface
+
+protected:
+    virtual void BeginPlay() override;
+
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+public:
+    virtual void TickComponent(
+        float DeltaTime,
+        ELevelTick TickType,
+        FActorComponentTickFunction* ThisTickFunction) override;
+
+    //~ END : UActorComponent Interface
+
+    //~ BEGIN : IRiveTickClient Interface
+
+public:
+    virtual void GatherArtboards(
+        TArray<URiveArtboard*>& OutArtboards) override;
+
+    virtual void TickRender(float InDeltaSeconds) override;
+
+    virtual ERiveTickPriority GetTickPriority() const override
+    {
+        return TickPriority;
+    }
+
+    //~ END : IRiveTickClient Interface
+
+    /**
+     * Implementation(s)
+     */
+
+public:
+    void Initialize();
+
+    /**
+     * Instantiates the artboard of RiveDescriptor in a free tile
+     * @param InMeshInstanceIndex Instance of the instanced mesh to show the
+     * tile on, none if negative
+     * @return Tile of the new instance, INDEX_NONE if not ready or full
+     */
+    UFUNCTION(BlueprintCallable, Category = Rive)
+    int32 AddInstance(int32 InMeshInstanceIndex = -1);
+
+    /** Releases the tile, its artboard stops ticking and drawing */
+    UFUNCTION(BlueprintCallable, Category = Rive)
+    void RemoveInstance(int32 InTile);
+
+    /** State machine of the instance in the tile, to drive its inputs */
+    FRiveStateMachine* GetInstanceStateMachine(int32 InTile) const;
+
+    UFUNCTION(BlueprintCallable, Category = Rive)
+    void SetInstanceBoolValue(int32 InTile,
+                              const FString& InPropertyName,
+                              bool bNewValue);
+
+    UFUNCTION(BlueprintCallable, Category = Rive)
+    void SetInstanceNumberValue(int32 InTile,
+                                const FString& InPropertyName,
+                                float NewValue);
+
+    UFUNCTION(BlueprintCallable, Category = Rive)
+    void FireInstanceTrigger(int32 InTile, const FString& InPropertyName);
+
+    UFUNCTION(BlueprintCallable, Category = Rive)
+    int32 GetInstanceCount() const
+    {
+        return ArtboardPool ? ArtboardPool->Num() : 0;
+    }
+
+    /**
+     * Shows the instance of the tile on an instance of the instanced mesh,
+     * kept up to date as the tile it is displayed from changes
+     */
+    UFUNCTION(BlueprintCallable, Category = Rive)
+    void SetMeshInstanceTile(int32 InMeshInstanceIndex, int32 InTile);
+
+    /**
+     * UV region of the atlas showing the instance of the tile, the tile of
+     * an identical instance when shared
+     */
+    UFUNCTION(BlueprintCallable, Category = Rive)
+    FBox2f GetTileUVRegion(int32 InTile) const;
+
+    UFUNCTION(BlueprintCallable, Category = Rive)
+    URiveTexture* GetAtlasTexture() const { return RiveTexture; }
+
+    UPROPERTY(BlueprintAssignable, Category = Rive)
+    FRiveReadyDelegate OnRiveReady;
+
+protected:
+    void RiveReady(IRiveRenderer* InRiveRenderer);
+    void OnResourceInitialized_RenderThread(
+        FRHICommandListImmediate& RHICmdList,
+        FTextureRHIRef& NewResource);
+
+private:
+    UInstancedStaticMeshComponent* GetMesh() const;
+    void BindToMesh();
+    FIntRect GetTileRect(int32 InTile) const;
+    void WriteMeshInstanceTile(int32 InMeshInstanceIndex, int32 InTile);
+
+    /**
+     * Points settled instances identical to an earlier one to its tile
+     * @return Number of instances displayed from another one's tile
+     */
+    int32 UpdateDisplayTiles();
+
+    /**
+     * Attribute(s)
+     */
+
+public:
+    /** Artboard and state machine every instance is made of */
+    UPROPERTY(BlueprintReadOnly, EditAnywhere, Category = Rive)
+    FRiveDescriptor RiveDescriptor;
+
+    /** Size in pixels of the tile of every instance */
+    UPROPERTY(EditAnywhere,
+              BlueprintReadOnly,
+              Category = Rive,
+              meta = (ClampMin = 1, UIMin = 1, ClampMax = 3840, UIMax = 3840))
+    FIntPoint TileSize = FIntPoint(128, 32);
+
+    /**
+     * Number of tiles in the atlas, allocated once when ready. Lowered to
+     * what fits in the largest Rive texture.
+     */
+    UPROPERTY(EditAnywhere,
+              BlueprintReadOnly,
+              Category = Rive,
+              meta = (ClampMin = 1, UIMin = 1))
+    int32 MaxInstances = 256;
+
+    /** Instanced mesh showing the tiles, the first one of our actor if unset */
+    UPROPERTY(EditAnywhere,
+              BlueprintReadWrite,
+              Category = Rive,
+              meta = (UseComponentPicker,
+                      AllowedClasses =
+                          "/Script/Engine.InstancedStaticMeshComponent"))
+    FComponentReference Mesh;
+
+    /** Material slot of Mesh the atlas is bound to */
+    UPROPERTY(EditAnywhere,
+              BlueprintReadWrite,
+              Category = Rive,
+              meta = (ClampMin = 0, UIMin = 0))
+    int32 MaterialIndex = 0;
+
+    /** Per instance custom data float of Mesh receiving the tile */
+    UPROPERTY(EditAnywhere,
+              BlueprintReadWrite,
+              Category = Rive,
+              meta = (ClampMin = 0, UIMin = 0))
+    int32 TileCustomDataIndex = 0;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Rive)
+    FName TextureParameterName = TEXT("RiveTexture");
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Rive)
+    FName ColumnsParameterName = TEXT("RiveAtlasColumns");
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Rive)
+    FName RowsParameterName = TEXT("RiveAtlasRows");
+
+    /**
+     * Whether the Rive tick subsystem can defer us when over its per frame
+     * budget (r.rive.tick.budgetms)
+     */
+    UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Rive)
+    ERiveTickPriority TickPriority = ERiveTickPriority::Normal;
+
+    /**
+     * Lowers how often the instances tick when the mesh is not rendered.
+     * Distances don't apply, instances are spread around.
+     */
+    UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Rive)
+    FRiveUpdateRatePolicy UpdateRatePolicy;
+
+private:
+    UPROPERTY(Transient)
+    TObjectPtr<URiveTexture> RiveTexture;
+
+    UPROPERTY(Transient)
+    TObjectPtr<UMaterialInstanceDynamic> MaterialInstance;
+
+    /** Artboard instances of RiveDescriptor's file */
+    TUniquePtr<FRiveArtboardPool> ArtboardPool;
+
+    /** Instance of every tile, unset for free tiles */
+    TArray<FRiveArtboardHandle> Instances;
+
+    /** Tile each instance is displayed from, its own unless shared */
+    TArray<int32> DisplayTiles;
+
+    /** Instance of the instanced mesh showing each tile, if any */
+    TArray<int32> MeshInstanceIndices;
+
+    TSharedPtr<IRiveRenderTarget> RiveRenderTarget;
+    FRiveUpdateRateState UpdateRateState;
+
+    int32 Columns = 1;
+    int32 Rows = 1;
+};
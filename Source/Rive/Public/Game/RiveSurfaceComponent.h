@@ -0,0 +1,115 @@
+// Copyright Rive, Inc. All rights reserved.
+
+#pragma once
+
+#include "Engine/EngineTypes.h"
+#include "Game/RiveActorComponent.h"
+#include "RiveSurfaceComponent.generated.h"
+
+class FRiveStateMachine;
+class UMaterialInstanceDynamic;
+class UPrimitiveComponent;
+
+/**
+ * Rive component for in-world screens. Binds its texture straight to a
+ * texture parameter of a mesh material, so the artboard is drawn once into
+ * its render target and sampled by the mesh, without going through a widget
+ * component and Slate. Pointer input comes from line trace hits on the mesh.
+ */
+UCLASS(ClassGroup = (Rive),
+       Meta = (BlueprintSpawnableComponent),
+       DisplayName = "Rive Surface")
+class RIVE_API URiveSurfaceComponent : public URiveActorComponent
+{
+    GENERATED_BODY()
+
+    /**
+     * Implementation(s)
+     */
+
+public:
+    /**
+     * Forwards a pointer press at the UV of a trace hit on our mesh to the
+     * default artboard. Hits only carry UVs for complex traces with Support
+     * UV From Hit Results enabled in the project physics settings.
+     * @return true if the state machine handled the hit
+     */
+    UFUNCTION(BlueprintCallable, Category = Rive)
+    bool PointerDownAtHit(const FHitResult& InHit);
+
+    UFUNCTION(BlueprintCallable, Category = Rive)
+    bool PointerUpAtHit(const FHitResult& InHit);
+
+    UFUNCTION(BlueprintCallable, Category = Rive)
+    bool PointerMoveAtHit(const FHitResult& InHit);
+
+    /** Same as PointerDownAtHit, for UVs found by other means */
+    UFUNCTION(BlueprintCallable, Category = Rive)
+    bool PointerDownAtUV(const FVector2D& InUV);
+
+    UFUNCTION(BlueprintCallable, Category = Rive)
+    bool PointerUpAtUV(const FVector2D& InUV);
+
+    UFUNCTION(BlueprintCallable, Category = Rive)
+    bool PointerMoveAtUV(const FVector2D& InUV);
+
+    /** Tells the default artboard the pointer left our mesh */
+    UFUNCTION(BlueprintCallable, Category = Rive)
+    void PointerExit();
+
+    /** Material instance of the mesh our texture is bound to, if any */
+    UFUNCTION(BlueprintCallable, Category = Rive)
+    UMaterialInstanceDynamic* GetMaterialInstance() const
+    {
+        return MaterialInstance;
+    }
+
+    /** Binds our texture to the mesh again, e.g. after a material change */
+    UFUNCTION(BlueprintCallable, Category = Rive)
+    void BindToMesh();
+
+protected:
+    virtual void RiveReady(IRiveRenderer* InRiveRenderer) override;
+
+private:
+    UPrimitiveComponent* GetMesh() const;
+
+    bool OnInput(const FVector2D& InUV,
+                 const TFunction<bool(const FVector2f&, FRiveStateMachine*)>&
+                     InStateMachineInputCallback);
+
+    /**
+     * Attribute(s)
+     */
+
+public:
+    /** Mesh showing our texture, the first primitive of our actor if unset */
+    UPROPERTY(EditAnywhere,
+              BlueprintReadWrite,
+              Category = Rive,
+              meta = (UseComponentPicker,
+                      AllowedClasses = "/Script/Engine.PrimitiveComponent"))
+    FComponentReference Mesh;
+
+    /** Material slot of Mesh our texture is bound to */
+    UPROPERTY(EditAnywhere,
+              BlueprintReadWrite,
+              Category = Rive,
+              meta = (ClampMin = 0, UIMin = 0))
+    int32 MaterialIndex = 0;
+
+    /** Texture parameter of the material receiving our texture */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Rive)
+    FName TextureParameterName = TEXT("RiveTexture");
+
+    /** UV channel of Mesh our texture is mapped with, for trace hits */
+    UPROPERTY(EditAnywhere,
+              BlueprintReadWrite,
+              Category = Rive,
+              meta = (ClampMin = 0, UIMin = 0))
+    int32 UVChannel = 0;
+
+private:
+    UPROPERTY(Transient)
+    TObjectPtr<UMaterialInstanceDynamic> MaterialInstance;
+};
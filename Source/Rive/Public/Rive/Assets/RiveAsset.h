@@ -34,11 +34,37 @@ class RIVE_API URiveAsset : public UObject
 
 public:
     virtual void PostLoad() override;
-    virtual bool LoadNativeAssetBytes(rive::FileAsset& InAsset,
-                                      rive::Factory* InRiveFactory,
-                                      const rive::Span<const uint8>& AssetBytes)
+    /** Decodes the bytes into InAsset and makes it our native asset */
+    bool LoadNativeAssetBytes(rive::FileAsset& InAsset,
+                              rive::Factory* InRiveFactory,
+                              const rive::Span<const uint8>& AssetBytes)
     {
-        return false;
+        TUniqueFunction<bool()> HandOver =
+            DecodeNativeAsset(InAsset, InRiveFactory, AssetBytes);
+        if (!HandOver || !HandOver())
+        {
+            return false;
+        }
+        NativeAsset = &InAsset;
+        return true;
+    }
+
+    /**
+     * Decodes the bytes, leaving this object untouched. Safe on any thread,
+     * and on the class default object, so that files can import before their
+     * URiveAssets are created and assets can decode side by side. Only the
+     * returned function may access InAsset or the factory's GPU resources,
+     * holding the renderer's GetThreadDataCS only while it creates them.
+     * @return Hands the decoded asset over to InAsset, false if it couldn't
+     * be decoded. Run by the thread importing the file. Unset if the type
+     * can't be decoded.
+     */
+    virtual TUniqueFunction<bool()> DecodeNativeAsset(
+        rive::FileAsset& InAsset,
+        rive::Factory* InRiveFactory,
+        const rive::Span<const uint8>& AssetBytes) const
+    {
+        return {};
     }
 
     UPROPERTY(VisibleAnywhere, Category = Rive, meta = (NoResetToDefault))
@@ -25,6 +25,16 @@ public:
 
     static ERiveAssetType GetUnrealType(uint16_t RiveType);
 
+    /**
+     * Copies a .riv file without the in-band contents of the assets in
+     * InAssetIds, which then load out of band.
+     * @return false if the file couldn't be read, OutFileData is then unset
+     */
+    static bool StripInBandAssets(TConstArrayView<uint8> InFileData,
+                                  const TSet<uint32>& InAssetIds,
+                                  TArray<uint8>& OutFileData,
+                                  TArray<uint32>& OutStrippedAssetIds);
+
     inline const static TArray<FString> FontExtensions = {"ttf", "otf"};
     inline const static TArray<FString> ImageExtensions = {"png"};
     inline const static TArray<FString> AudioExtensions = {"wav",
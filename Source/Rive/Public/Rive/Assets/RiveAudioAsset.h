@@ -15,8 +15,8 @@ class RIVE_API URiveAudioAsset : public URiveAsset
     GENERATED_BODY()
 
     URiveAudioAsset();
-    virtual bool LoadNativeAssetBytes(
+    virtual TUniqueFunction<bool()> DecodeNativeAsset(
         rive::FileAsset& InAsset,
         rive::Factory* InRiveFactory,
-        const rive::Span<const uint8>& AssetBytes) override;
+        const rive::Span<const uint8>& AssetBytes) const override;
 };
@@ -3,6 +3,8 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Rive/Assets/RiveAsset.h"
+#include "Tasks/Task.h"
 #include "UObject/ObjectPtr.h"
 
 #if WITH_RIVE
@@ -24,6 +26,13 @@ THIRD_PARTY_INCLUDES_END
  * Unreal extension of rive::FileAssetLoader implementation (partial) for the
  * Unreal RHI. This loads assets (either embedded or OOB by using their loaded
  * bytes)
+ *
+ * Loading only decodes into the native assets, so that files can import off
+ * the game thread. The URiveAssets they belong to are created and updated
+ * afterwards, by FinishLoading.
+ *
+ * With r.rive.paralleldecode, assets decode on tasks of their own while the
+ * file keeps importing, and are handed over to the file by FinishDecoding.
  */
 class RIVE_API FRiveFileAssetLoader
 #if WITH_RIVE
@@ -49,6 +58,20 @@ public:
 
     //~ END : rive::FileAssetLoader Interface
 
+    /**
+     * Waits for the assets decoding in parallel and, if the file imported,
+     * hands them over to it. Call right after the import, on its thread and
+     * without GetThreadDataCS held.
+     */
+    void FinishDecoding(bool bInImported);
+
+    /**
+     * Creates the URiveAssets of the assets loaded so far, replaces the ones
+     * of an outdated class, and points the decoded ones to their native
+     * asset. Game thread only, once the import succeeded.
+     */
+    void FinishLoading();
+
 #endif // WITH_RIVE
 
 public:
@@ -59,4 +82,17 @@ public:
 private:
     TObjectPtr<UObject> Outer;
     TMap<uint32, TObjectPtr<URiveAsset>>& Assets;
+
+#if WITH_RIVE
+    struct FLoadedAsset
+    {
+        rive::FileAsset* NativeAsset = nullptr;
+        ERiveAssetType Type = ERiveAssetType::None;
+        /** Set when decoding in parallel, returns the hand over */
+        UE::Tasks::TTask<TUniqueFunction<bool()>> DecodeTask;
+        bool bDecoded = false;
+    };
+
+    TArray<FLoadedAsset> LoadedAssets;
+#endif // WITH_RIVE
 };
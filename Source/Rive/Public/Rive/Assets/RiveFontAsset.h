@@ -23,8 +23,8 @@ class RIVE_API URiveFontAsset : public URiveAsset
     UFUNCTION(BlueprintCallable, Category = Rive)
     void LoadFontBytes(const TArray<uint8>& InBytes);
 
-    virtual bool LoadNativeAssetBytes(
+    virtual TUniqueFunction<bool()> DecodeNativeAsset(
         rive::FileAsset& InAsset,
         rive::Factory* InRiveFactory,
-        const rive::Span<const uint8>& AssetBytes) override;
+        const rive::Span<const uint8>& AssetBytes) const override;
 };
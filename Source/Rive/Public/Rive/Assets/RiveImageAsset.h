@@ -22,8 +22,13 @@ class RIVE_API URiveImageAsset : public URiveAsset
     UFUNCTION(BlueprintCallable, Category = Rive)
     void LoadImageBytes(const TArray<uint8>& InBytes);
 
-    virtual bool LoadNativeAssetBytes(
+    virtual TUniqueFunction<bool()> DecodeNativeAsset(
         rive::FileAsset& InAsset,
         rive::Factory* InRiveFactory,
-        const rive::Span<const uint8>& AssetBytes) override;
+        const rive::Span<const uint8>& AssetBytes) const override;
+
+private:
+    /** Texture our image samples in place, kept alive while it does */
+    UPROPERTY(Transient)
+    TObjectPtr<UTexture2D> LoadedTexture;
 };
@@ -51,6 +51,10 @@ public:
                                        DeltaTime,
                                        URiveArtboard*,
                                        Artboard);
+    /** Native counterpart of FRiveTickDelegate, skips UFunction dispatch */
+    DECLARE_DELEGATE_TwoParams(FRiveNativeTickDelegate,
+                               float /* DeltaTime */,
+                               URiveArtboard* /* Artboard */);
 
     virtual void BeginDestroy() override;
 
@@ -66,6 +70,12 @@ public:
     UPROPERTY(BlueprintReadWrite, Category = Rive)
     FRiveTickDelegate OnArtboardTick_Render;
 
+    /**
+     * Default render of C++ owners, OnArtboardTick_Render runs instead when
+     * bound
+     */
+    FRiveNativeTickDelegate OnArtboardTick_RenderNative;
+
     UPROPERTY(BlueprintReadWrite, Category = Rive)
     FRiveTickDelegate OnArtboardTick_StateMachine;
 
@@ -73,7 +83,11 @@ public:
     FRiveCoordinatesDelegate OnGetLocalCoordinate;
 
     UFUNCTION(BlueprintCallable, Category = Rive)
-    bool HasCustomRender() { return OnArtboardTick_Render.IsBound(); }
+    bool HasCustomRender()
+    {
+        return OnArtboardTick_RenderNative.IsBound() ||
+               OnArtboardTick_Render.IsBound();
+    }
 
     UFUNCTION(BlueprintCallable, Category = Rive)
     FVector2f GetSize() const;
@@ -242,6 +256,27 @@ public:
     bool IsInitialized() const { return bIsInitialized; }
 
     void Tick(float InDeltaSeconds);
+
+    /**
+     * Advances the state machines of all the given artboards, in parallel on
+     * the task graph when r.rive.paralleladvance allows it. Reported events
+     * and custom state machine tick delegates are handled on the game thread.
+     * Follow up with Tick_Render on each artboard to draw them.
+     */
+    static void AdvanceStateMachines(
+        TConstArrayView<URiveArtboard*> InArtboards,
+        float InDeltaSeconds);
+
+    /**
+     * Whether InNum state machines advanced together go wide on the task
+     * graph, as allowed by r.rive.paralleladvance
+     * @param OutMinBatchSize Smallest number of them advanced by one task
+     */
+    static bool ShouldAdvanceInParallel(int32 InNum, int32& OutMinBatchSize);
+
+    /** Draws the artboard, or runs OnArtboardTick_Render if bound */
+    void Tick_Render(float InDeltaSeconds);
+
     /**
      * Implementation(s)
      */
@@ -253,6 +288,26 @@ public:
 
     FRiveStateMachine* GetStateMachine() const;
 
+    /**
+     * Lock guarding this artboard's native instance and state machine. Render
+     * commands drawing the artboard share it, so the render thread only ever
+     * waits on the owner of the artboard it is drawing.
+     */
+    FCriticalSection& GetArtboardCS() const { return *ArtboardCS; }
+
+    /**
+     * Whether the last advance left the state machine with nothing more to
+     * animate, so that drawing again gives the same picture until an input
+     * changes. Never settled with Blueprint tick delegates, whose effect we
+     * can't know. The native render of our owner draws the same picture for
+     * the same state, it doesn't count.
+     */
+    bool IsSettled() const
+    {
+        return bIsSettled && !OnArtboardTick_Render.IsBound() &&
+               !OnArtboardTick_StateMachine.IsBound();
+    }
+
     void BeginInput() { bIsReceivingInput = true; }
 
     void EndInput() { bIsReceivingInput = false; }
@@ -266,13 +321,15 @@ private:
     void PopulateReportedEvents();
 
     void Initialize_Internal(const rive::Artboard* InNativeArtboard);
-    void Tick_Render(float InDeltaSeconds);
     void Tick_StateMachine(float InDeltaSeconds);
 
     TSharedPtr<IRiveRenderTarget> RiveRenderTarget;
 
     std::unique_ptr<rive::ArtboardInstance> NativeArtboardPtr = nullptr;
     TUniquePtr<FRiveStateMachine> StateMachinePtr = nullptr;
+
+    FRiveArtboardCSPtr ArtboardCS =
+        MakeShared<FCriticalSection, ESPMode::ThreadSafe>();
 #endif // WITH_RIVE
 public:
     const FString& GetArtboardName() const { return ArtboardName; }
@@ -334,4 +391,7 @@ protected:
     TArray<FRiveEvent> TickRiveReportedEvents;
 
     bool bIsReceivingInput = false;
+
+    /** See IsSettled */
+    bool bIsSettled = false;
 };
@@ -0,0 +1,71 @@
+// Copyright Rive, Inc. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/NoExportTypes.h"
+#include "RiveArtboardInfo.generated.h"
+
+UENUM(BlueprintType)
+enum class ERiveInputType : uint8
+{
+    Unknown = 0,
+    Bool = 1,
+    Number = 2,
+    Trigger = 3,
+};
+
+USTRUCT(BlueprintType)
+struct RIVE_API FRiveInputInfo
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = Rive)
+    FString Name;
+
+    UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = Rive)
+    ERiveInputType Type = ERiveInputType::Unknown;
+};
+
+USTRUCT(BlueprintType)
+struct RIVE_API FRiveStateMachineInfo
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = Rive)
+    FString Name;
+
+    UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = Rive)
+    TArray<FRiveInputInfo> Inputs;
+};
+
+/**
+ * What an artboard of a Rive file holds, read from the file without
+ * instancing the artboard. Saved with the file, so that it is known before
+ * the file initializes, or when none of its artboards ever gets instanced.
+ */
+USTRUCT(BlueprintType)
+struct RIVE_API FRiveArtboardInfo
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = Rive)
+    FString Name;
+
+    UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = Rive)
+    TArray<FRiveStateMachineInfo> StateMachines;
+
+    UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = Rive)
+    TArray<FString> EventNames;
+
+    TArray<FString> GetStateMachineNames() const
+    {
+        TArray<FString> Names;
+        Names.Reserve(StateMachines.Num());
+        for (const FRiveStateMachineInfo& StateMachine : StateMachines)
+        {
+            Names.Add(StateMachine.Name);
+        }
+        return Names;
+    }
+};
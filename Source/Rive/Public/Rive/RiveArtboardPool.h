@@ -0,0 +1,155 @@
+// Copyright Rive, Inc. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "IRiveRenderTarget.h"
+#include "RiveTypes.h"
+
+#if WITH_RIVE
+THIRD_PARTY_INCLUDES_START
+#include "rive/artboard.hpp"
+THIRD_PARTY_INCLUDES_END
+#endif // WITH_RIVE
+
+class FRiveStateMachine;
+class URiveFile;
+
+/**
+ * Names found in a native artboard, shared by every instance of it instead of
+ * being gathered again for each one
+ */
+struct RIVE_API FRiveArtboardMetadata
+{
+    FString ArtboardName;
+    TArray<FString> StateMachineNames;
+    TArray<FString> EventNames;
+};
+
+/**
+ * Handle to an artboard instance of a FRiveArtboardPool. Stays safe to use
+ * once the instance is released, the pool just ignores it.
+ */
+struct FRiveArtboardHandle
+{
+    int32 Index = INDEX_NONE;
+    uint32 Generation = 0;
+
+    bool IsSet() const { return Index != INDEX_NONE; }
+
+    bool operator==(const FRiveArtboardHandle& Other) const
+    {
+        return Index == Other.Index && Generation == Other.Generation;
+    }
+};
+
+/**
+ * Native artboard instances of a single Rive file, for owners running
+ * thousands of them such as URiveInstancedComponent. Unlike URiveArtboard,
+ * instances are plain entries of a contiguous array: no UObject, no garbage
+ * collection, no per instance copy of the artboard metadata and no reported
+ * event broadcast. Game thread only, except for drawing.
+ *
+ * Every instance is released when the file starts initializing again, e.g.
+ * on reimport, as native instances can't outlive their file.
+ */
+class RIVE_API FRiveArtboardPool
+{
+    /**
+     * Structor(s)
+     */
+
+public:
+    explicit FRiveArtboardPool(URiveFile* InRiveFile);
+    ~FRiveArtboardPool();
+
+    FRiveArtboardPool(const FRiveArtboardPool&) = delete;
+    FRiveArtboardPool& operator=(const FRiveArtboardPool&) = delete;
+
+    /**
+     * Implementation(s)
+     */
+
+public:
+    /**
+     * Instantiates an artboard of our file
+     * @param InArtboardName Default artboard if empty or not found
+     * @param InStateMachineName Default state machine if empty or not found
+     * @return Unset handle if the file is not initialized
+     */
+    FRiveArtboardHandle Create(const FString& InArtboardName,
+                               const FString& InStateMachineName);
+
+    void Release(const FRiveArtboardHandle& InHandle);
+
+    /**
+     * Releases every instance, outstanding handles become invalid. Entries
+     * are kept, for their generation to tell old handles apart.
+     */
+    void Reset();
+
+    bool IsValid(const FRiveArtboardHandle& InHandle) const
+    {
+        return Instances.IsValidIndex(InHandle.Index) &&
+               Instances[InHandle.Index].Generation == InHandle.Generation &&
+               Instances[InHandle.Index].NativeArtboard != nullptr;
+    }
+
+    int32 Num() const { return Instances.Num() - FreeIndices.Num(); }
+
+    URiveFile* GetFile() const { return RiveFile.Get(); }
+
+    rive::ArtboardInstance* GetNativeArtboard(
+        const FRiveArtboardHandle& InHandle) const;
+
+    FRiveStateMachine* GetStateMachine(
+        const FRiveArtboardHandle& InHandle) const;
+
+    const FRiveArtboardMetadata* GetMetadata(
+        const FRiveArtboardHandle& InHandle) const;
+
+    /** See URiveArtboard::IsSettled */
+    bool IsSettled(const FRiveArtboardHandle& InHandle) const;
+
+    /**
+     * Advances the state machine of every instance, in parallel when
+     * r.rive.paralleladvance allows it
+     */
+    void AdvanceAll(float InDeltaSeconds);
+
+    /** Records the instance aligned into the box, into the render target */
+    void Draw(const FRiveArtboardHandle& InHandle,
+              IRiveRenderTarget& InRenderTarget,
+              const FBox2f& InBox,
+              ERiveFitType InFitType,
+              ERiveAlignment InAlignment,
+              float InScaleFactor) const;
+
+    /**
+     * Attribute(s)
+     */
+
+private:
+    struct FInstance
+    {
+        std::unique_ptr<rive::ArtboardInstance> NativeArtboard;
+        TUniquePtr<FRiveStateMachine> StateMachine;
+        FRiveArtboardCSPtr ArtboardCS;
+        TSharedPtr<const FRiveArtboardMetadata> Metadata;
+        uint32 Generation = 0;
+        bool bIsSettled = false;
+    };
+
+    void OnFileStartInitializing();
+
+    const FInstance* Find(const FRiveArtboardHandle& InHandle) const
+    {
+        return IsValid(InHandle) ? &Instances[InHandle.Index] : nullptr;
+    }
+
+    TWeakObjectPtr<URiveFile> RiveFile;
+    FDelegateHandle FileInitializingHandle;
+
+    TArray<FInstance> Instances;
+    TArray<int32> FreeIndices;
+};
@@ -0,0 +1,47 @@
+// Copyright Rive, Inc. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/EngineSubsystem.h"
+#include "RiveAtlasSubsystem.generated.h"
+
+class URiveTextureAtlas;
+class URiveTextureObject;
+
+/**
+ * Owns the pages of the shared Rive widget atlas and hands out slots to
+ * URiveTextureObjects using bUseSharedAtlas.
+ */
+UCLASS()
+class RIVE_API URiveAtlasSubsystem : public UEngineSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    static URiveAtlasSubsystem* Get();
+
+    //~ BEGIN : USubsystem Interface
+    virtual void Deinitialize() override;
+    //~ END : USubsystem Interface
+
+    /**
+     * Finds room for the owner in an atlas page, trying its current page
+     * first and creating a new page if none has room
+     * @param InCurrentAtlas Page currently holding the owner, if any. The
+     * owner is removed from it if it ends up elsewhere.
+     * @return The page holding the owner, or nullptr if the size is too large
+     * for the atlas
+     */
+    URiveTextureAtlas* AcquireSlot(URiveTextureObject* InOwner,
+                                   const FIntPoint& InSize,
+                                   URiveTextureAtlas* InCurrentAtlas = nullptr);
+
+    void ReleaseSlot(URiveTextureObject* InOwner, URiveTextureAtlas* InAtlas);
+
+private:
+    void UpdateStats() const;
+
+    UPROPERTY(Transient)
+    TArray<TObjectPtr<URiveTextureAtlas>> Pages;
+};
@@ -6,6 +6,9 @@
 #include "Blueprint/UserWidget.h"
 #include "CoreMinimal.h"
 #include "RiveTypes.h"
+#include "Rive/RiveArtboardInfo.h"
+#include "Serialization/BulkData.h"
+#include "Tasks/Task.h"
 #include "UObject/Object.h"
 
 #if WITH_RIVE
@@ -18,8 +21,11 @@ THIRD_PARTY_INCLUDES_END
 
 #include "RiveFile.generated.h"
 
+class FRiveFileAssetLoader;
+class IRiveRenderer;
 class URiveAsset;
 class URiveArtboard;
+struct FRiveArtboardMetadata;
 
 /**
  *
@@ -38,7 +44,18 @@ public:
     DECLARE_DYNAMIC_MULTICAST_DELEGATE(FRiveReadyDelegate);
 
     void BeginDestroy() override;
+    bool IsReadyForFinishDestroy() override;
     void PostLoad() override;
+    void Serialize(FArchive& Ar) override;
+#if WITH_EDITOR
+    void PreSave(FObjectPreSaveContext ObjectSaveContext) override;
+#endif // WITH_EDITOR
+
+    /**
+     * Imports the file data, on a worker thread when r.rive.asyncimport
+     * allows it. Initialization delegates fire on the game thread once done,
+     * see IsInitialized.
+     */
     void Initialize();
 
     void SetWidgetClass(TSubclassOf<UUserWidget> InWidgetClass)
@@ -69,14 +86,18 @@ public:
               meta = (NoResetToDefault, AllowPrivateAccess))
     TArray<FString> ArtboardNames;
 
-    // This is only meant as a display feature for the editor, and not meant to
-    // be used as functional code
-    UPROPERTY(Transient,
-              VisibleInstanceOnly,
+    /**
+     * Names of the artboards, state machines, inputs and events of the file,
+     * in artboard order. Refreshed on every import and saved with us, so that
+     * dropdowns and tools don't need to initialize the file or instance any
+     * artboard to list them.
+     */
+    UPROPERTY(VisibleAnywhere,
+              BlueprintReadOnly,
               Category = Rive,
               NonTransactional,
               meta = (NoResetToDefault, AllowPrivateAccess))
-    TArray<URiveArtboard*> Artboards;
+    TArray<FRiveArtboardInfo> ArtboardInfos;
 
     UFUNCTION()
     TArray<FString> GetArtboardNamesForDropdown() const
@@ -84,6 +105,43 @@ public:
         return ArtboardNames;
     }
 
+    /** Info of the artboard named InArtboardName, null if there is none */
+    const FRiveArtboardInfo* FindArtboardInfo(
+        const FString& InArtboardName) const
+    {
+        return ArtboardInfos.FindByPredicate(
+            [&InArtboardName](const FRiveArtboardInfo& Info) {
+                return Info.Name.Equals(InArtboardName);
+            });
+    }
+
+    /**
+     * Primes an artboard before it is first shown, e.g. during a loading
+     * screen: instances it, advances it and draws it once off screen, so that
+     * its image uploads, pipeline states and renderer resource growth are
+     * paid for there instead of on the first visible frame. The artboard is
+     * kept until taken by whoever shows it (see TakePrewarmedArtboard) or
+     * ReleasePrewarmedArtboards. Requires us to be initialized.
+     * @param InArtboardName Default artboard if empty or not found
+     * @param InStateMachineName Default state machine if empty or not found
+     * @return The prewarmed artboard, null if it couldn't be
+     */
+    UFUNCTION(BlueprintCallable, Category = Rive)
+    URiveArtboard* PrewarmArtboard(const FString& InArtboardName,
+                                   const FString& InStateMachineName);
+
+    /**
+     * Hands over the artboard prewarmed for these names, for the caller to
+     * draw into its own render target
+     * @return Null if none was prewarmed
+     */
+    URiveArtboard* TakePrewarmedArtboard(const FString& InArtboardName,
+                                         const FString& InStateMachineName);
+
+    /** Lets go of the artboards prewarmed and not taken */
+    UFUNCTION(BlueprintCallable, Category = Rive)
+    void ReleasePrewarmedArtboards();
+
     UPROPERTY(meta = (NoResetToDefault))
     FString RiveFilePath_DEPRECATED;
 
@@ -91,22 +149,89 @@ public:
     // This property holds the import data
     UPROPERTY(VisibleAnywhere, Instanced, Category = "Import Settings")
     UAssetImportData* AssetImportData;
+
+    /**
+     * Compresses the file data with Oodle when saved. Smaller on disk, but the
+     * data can't be memory mapped and is decompressed on load.
+     */
+    UPROPERTY(EditAnywhere, Category = "Storage")
+    bool bCompressPayload = false;
+
+    /**
+     * Lets cooked builds memory map the uncompressed file data from the pak
+     * or IoStore container, so that imports read it in place instead of from
+     * a copy, where the platform supports it (r.rive.file.memorymap)
+     */
+    UPROPERTY(EditAnywhere,
+              Category = "Storage",
+              meta = (EditCondition = "!bCompressPayload"))
+    bool bMemoryMapPayload = true;
 #endif
 
 private:
+#if WITH_RIVE
+    void StartAsyncImport(IRiveRenderer* InRiveRenderer);
+    /** Reads ArtboardInfos from the source artboards of our native file */
+    void BuildArtboardInfos();
+    void FinishImport(IRiveRenderer* InRiveRenderer,
+                      std::unique_ptr<rive::File>&& InNativeFile,
+                      FRiveFileAssetLoader& InAssetLoader);
+#endif // WITH_RIVE
+
     void BroadcastInitializationResult(bool bSuccess);
+
+    /** Replaces RiveFileBulkData, Initialize imports it again */
+    void SetFileData(const TArray<uint8>& InFileData);
+
+#if WITH_EDITOR
+    /**
+     * Fills StrippedFileBulkData with our file data minus the in-band bytes
+     * of the assets we have out of band bytes for (r.rive.cook.stripassets)
+     */
+    void StripInBandAssets();
+#endif // WITH_EDITOR
+
+    /** Import running on a worker thread, reading our data and assets */
+    UE::Tasks::FTask ImportTask;
+
     TOptional<bool> WasLastInitializationSuccessful{};
     FOnRiveFileInitializationResult OnInitializedOnceDelegate;
 
     UPROPERTY(Transient, meta = (NoResetToDefault))
     ERiveInitState InitState = ERiveInitState::Uninitialized;
 
+    /** File data of assets saved before it moved to RiveFileBulkData */
     UPROPERTY()
-    TArray<uint8> RiveFileData;
+    TArray<uint8> RiveFileData_DEPRECATED;
+
+    /**
+     * The .riv data, saved apart from the rest of us so that it is only read
+     * when we first initialize, not along with our package
+     */
+    FByteBulkData RiveFileBulkData;
+
+#if WITH_EDITORONLY_DATA
+    /** What we cook instead of RiveFileBulkData, when set */
+    FByteBulkData StrippedFileBulkData;
+#endif // WITH_EDITORONLY_DATA
+
+    /**
+     * Assets whose in-band bytes were stripped when we were cooked, they load
+     * from their URiveAsset instead
+     */
+    UPROPERTY(VisibleAnywhere, Category = Rive, meta = (NoResetToDefault))
+    TArray<uint32> StrippedAssetIds;
 
     UPROPERTY(VisibleAnywhere, Category = Rive, meta = (NoResetToDefault))
     TSubclassOf<UUserWidget> WidgetClass;
 
+    TMap<const rive::Artboard*, TSharedPtr<const FRiveArtboardMetadata>>
+        ArtboardMetadata;
+
+    /** Artboards primed by PrewarmArtboard, by the names they were asked */
+    UPROPERTY(Transient)
+    TMap<FString, TObjectPtr<URiveArtboard>> PrewarmedArtboards;
+
 public:
     UPROPERTY(VisibleAnywhere, Category = Rive, meta = (NoResetToDefault))
     TMap<uint32, TObjectPtr<URiveAsset>> Assets;
@@ -156,6 +281,13 @@ public:
         return nullptr;
     }
 
+    /**
+     * Names found in one of our native artboards, gathered on first request
+     * and shared by every instance of it until we initialize again
+     */
+    TSharedPtr<const FRiveArtboardMetadata> GetArtboardMetadata(
+        const rive::Artboard* InNativeArtboard);
+
     void PrintStats() const;
 
 #if WITH_EDITOR
@@ -0,0 +1,60 @@
+// Copyright Rive, Inc. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintAsyncActionBase.h"
+#include "RiveFileWaitAction.generated.h"
+
+class URiveFile;
+
+/**
+ * Blueprint node waiting for a Rive file to be initialized, which happens
+ * over several frames when files import on worker threads
+ */
+UCLASS()
+class RIVE_API URiveFileWaitAction : public UBlueprintAsyncActionBase
+{
+    GENERATED_BODY()
+
+    DECLARE_DYNAMIC_MULTICAST_DELEGATE(FRiveFileWaitDelegate);
+
+    /**
+     * Implementation(s)
+     */
+
+public:
+    /** Completes right away if the file is already initialized */
+    UFUNCTION(BlueprintCallable,
+              Category = Rive,
+              meta = (BlueprintInternalUseOnly = "true",
+                      WorldContext = "WorldContextObject"))
+    static URiveFileWaitAction* WaitForRiveFile(UObject* WorldContextObject,
+                                                URiveFile* RiveFile);
+
+    //~ BEGIN : UBlueprintAsyncActionBase Interface
+
+    virtual void Activate() override;
+
+    //~ END : UBlueprintAsyncActionBase Interface
+
+private:
+    void OnFileInitialized(bool bSuccess);
+
+    /**
+     * Attribute(s)
+     */
+
+public:
+    UPROPERTY(BlueprintAssignable)
+    FRiveFileWaitDelegate Initialized;
+
+    UPROPERTY(BlueprintAssignable)
+    FRiveFileWaitDelegate Failed;
+
+private:
+    UPROPERTY(Transient)
+    TObjectPtr<URiveFile> RiveFile;
+
+    FDelegateHandle InitializedHandle;
+};
@@ -2,6 +2,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "RiveTypes.h"
 
 #if WITH_RIVE
 
@@ -35,8 +36,13 @@ public:
     bool IsValid() const { return NativeStateMachinePtr != nullptr; }
 #if WITH_RIVE
 
+    /**
+     * @param InArtboardCS Lock of the owning artboard, taken by every call on
+     * this state machine
+     */
     explicit FRiveStateMachine(rive::ArtboardInstance* InNativeArtboardInst,
-                               const FString& InStateMachineName);
+                               const FString& InStateMachineName,
+                               const FRiveArtboardCSPtr& InArtboardCS);
 
     /**
      * Implementation(s)
@@ -49,6 +55,19 @@ public:
 
     rive::SMIInput* GetInput(uint32 AtIndex) const;
 
+    /**
+     * Appends the values of the bool and number inputs in order, bools as 0
+     * or 1. Triggers are left out, they don't persist past an advance.
+     */
+    void GetInputValues(TArray<float>& OutValues) const;
+
+    /**
+     * Whether the values of GetInputValues alone decide our state once
+     * settled. Not so with triggers, whose firing leaves no value behind, nor
+     * with listeners, which change state from pointer input and events.
+     */
+    bool IsStateDecidedByInputValues() const;
+
     void FireTrigger(const FString& InPropertyName) const;
 
     bool GetBoolValue(const FString& InPropertyName) const;
@@ -87,6 +106,9 @@ private:
 
     std::unique_ptr<rive::StateMachineInstance> NativeStateMachinePtr = nullptr;
 
+    FRiveArtboardCSPtr ArtboardCS =
+        MakeShared<FCriticalSection, ESPMode::ThreadSafe>();
+
     static rive::EventReport NullEvent;
 
 #endif // WITH_RIVE
@@ -56,6 +56,13 @@ public:
     virtual void ResizeRenderTargets(FIntPoint InNewSize);
     virtual void ResizeRenderTargets(const FVector2f InNewSize);
 
+    /**
+     * Rounds the size up to the next resize bucket
+     * (r.rive.texture.resizebucket), so that continuous resizes only
+     * reallocate the render target once in a while
+     */
+    static FIntPoint GetResizeBucketSize(const FIntPoint& InSize);
+
     FVector2f GetLocalCoordinatesFromExtents(URiveArtboard* InArtboard,
                                              const FVector2f& InPosition,
                                              const FBox2f& InExtents) const;
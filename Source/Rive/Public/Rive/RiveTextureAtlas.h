@@ -0,0 +1,130 @@
+// Copyright Rive, Inc. All rights reserved.
+
+#pragma once
+
+#include "IRiveRenderTarget.h"
+#include "RiveTexture.h"
+#include "RiveTickSubsystem.h"
+#include "Tickable.h"
+#include "RiveTextureAtlas.generated.h"
+
+class IRiveRenderer;
+class URiveTextureObject;
+
+/**
+ * A single page of the shared Rive widget atlas. Small URiveTextureObjects
+ * are packed into the page with one sub-rect each, and the page draws all of
+ * them into its render target with a single submit per frame.
+ */
+UCLASS(Transient)
+class RIVE_API URiveTextureAtlas : public URiveTexture,
+                                   public FTickableGameObject,
+                                   public IRiveTickClient
+{
+    GENERATED_BODY()
+
+public:
+    /**
+     * Structor(s)
+     */
+
+    virtual void BeginDestroy() override;
+
+    //~ BEGIN : FTickableGameObject Interface
+
+public:
+    virtual TStatId GetStatId() const override;
+
+    virtual void Tick(float InDeltaSeconds) override;
+
+    virtual bool IsTickable() const override
+    {
+        return !HasAnyFlags(RF_ClassDefaultObject) && RiveRenderTarget &&
+               !Slots.IsEmpty();
+    }
+
+#if WITH_EDITOR
+    virtual bool IsTickableInEditor() const override { return IsTickable(); }
+#endif
+
+    virtual ETickableTickType GetTickableTickType() const override
+    {
+        return ETickableTickType::Conditional;
+    }
+
+    //~ END : FTickableGameObject Interface
+
+    //~ BEGIN : IRiveTickClient Interface
+
+public:
+    virtual void GatherArtboards(
+        TArray<URiveArtboard*>& OutArtboards) override;
+
+    virtual void TickRender(float InDeltaSeconds) override;
+
+    virtual ERiveTickPriority GetTickPriority() const override;
+
+    //~ END : IRiveTickClient Interface
+
+    /**
+     * Implementation(s)
+     */
+
+public:
+    /** Size in pixels of every atlas page (r.rive.atlas.pagesize) */
+    static int32 GetPageSize();
+
+    /** Largest slot the atlas accepts (r.rive.atlas.maxslotsize) */
+    static int32 GetMaxSlotSize();
+
+    void Initialize(IRiveRenderer* InRiveRenderer);
+
+    /**
+     * Adds a slot for the given owner and repacks the page
+     * @return false if the slot does not fit, the page is left untouched
+     */
+    bool AddSlot(URiveTextureObject* InOwner, const FIntPoint& InSize);
+
+    /**
+     * Changes the size of an existing slot and repacks the page
+     * @return false if the new size does not fit, the page is left untouched
+     */
+    bool ResizeSlot(URiveTextureObject* InOwner, const FIntPoint& InSize);
+
+    void RemoveSlot(URiveTextureObject* InOwner);
+
+    bool HasSlots() const { return !Slots.IsEmpty(); }
+
+    /** Pixel rect of the owner's slot in this page */
+    FIntRect GetSlotRect(const URiveTextureObject* InOwner) const;
+
+    /** UV rect of the owner's slot in this page, for Slate brushes */
+    FBox2f GetSlotUVRegion(const URiveTextureObject* InOwner) const;
+
+    const TSharedPtr<IRiveRenderTarget>& GetRiveRenderTarget() const
+    {
+        return RiveRenderTarget;
+    }
+
+private:
+    /**
+     * Shelf packs every slot, tallest first
+     * @return false if the slots do not fit in the page
+     */
+    bool Repack();
+
+    void OnResourceInitialized_RenderThread(
+        FRHICommandListImmediate& RHICmdList,
+        FTextureRHIRef& NewResource) const;
+
+    struct FSlot
+    {
+        TWeakObjectPtr<URiveTextureObject> Owner;
+        FIntPoint Size = FIntPoint::ZeroValue;
+        FIntRect Rect;
+    };
+
+    TArray<FSlot> Slots;
+
+    TSharedPtr<IRiveRenderTarget> RiveRenderTarget;
+};
@@ -4,7 +4,10 @@
 
 #include "IRiveRenderTarget.h"
 #include "RiveDescriptor.h"
+#include "RiveRenderCommand.h"
 #include "RiveTexture.h"
+#include "RiveTickSubsystem.h"
+#include "RiveUpdateRate.h"
 #include "RiveTypes.h"
 #include "Tickable.h"
 #include "RiveTextureObject.generated.h"
@@ -26,6 +29,7 @@ class File;
 class URiveAsset;
 class UUserWidget;
 class URiveFile;
+class URiveTextureAtlas;
 
 /**
  * This class represents the logical side of a single RiveTexture /
@@ -40,7 +44,8 @@ UCLASS(BlueprintType,
                          "LevelOfDetail",
                          "Compositing"))
 class RIVE_API URiveTextureObject : public URiveTexture,
-                                    public FTickableGameObject
+                                    public FTickableGameObject,
+                                    public IRiveTickClient
 {
     GENERATED_BODY()
     DECLARE_DYNAMIC_MULTICAST_DELEGATE(FRiveReadyDelegate);
@@ -61,16 +66,19 @@ public:
 
     virtual void Tick(float InDeltaSeconds) override;
 
+    // When packed in an atlas, the atlas page ticks us so all of its slots
+    // can be submitted together
     virtual bool IsTickable() const override
     {
-        return !HasAnyFlags(RF_ClassDefaultObject) && bIsRendering;
+        return !HasAnyFlags(RF_ClassDefaultObject) && bIsRendering &&
+               Atlas == nullptr;
     }
 
 #if WITH_EDITOR
     virtual bool IsTickableInEditor() const override
     {
         return !HasAnyFlags(RF_ClassDefaultObject) && bIsRendering &&
-               bRenderInEditor;
+               bRenderInEditor && Atlas == nullptr;
     }
 #endif
 
@@ -81,6 +89,29 @@ public:
 
     //~ END : FTickableGameObject Interface
 
+    //~ BEGIN : IRiveTickClient Interface
+
+public:
+    virtual void GatherArtboards(
+        TArray<URiveArtboard*>& OutArtboards) override;
+
+    virtual void TickRender(float InDeltaSeconds) override;
+
+    virtual ERiveTickPriority GetTickPriority() const override
+    {
+        return TickPriority;
+    }
+
+    //~ END : IRiveTickClient Interface
+
+    //~ BEGIN : URiveTexture Interface
+
+public:
+    using URiveTexture::ResizeRenderTargets;
+    virtual void ResizeRenderTargets(FIntPoint InNewSize) override;
+
+    //~ END : URiveTexture Interface
+
     /**
      * Implementation(s)
      */
@@ -119,12 +150,67 @@ public:
     UPROPERTY(BlueprintAssignable, Category = Rive)
     FRiveReadyDelegate OnRiveReady;
 
+    /**
+     * Texture to display for this object: the shared atlas page when packed
+     * in one, this texture otherwise
+     */
+    URiveTexture* GetDisplayTexture();
+
+    /** UV region of GetDisplayTexture() holding this object's artboard */
+    FBox2f GetDisplayUVRegion() const;
+
+    /**
+     * Size the artboard is drawn at. Smaller than Size when the render target
+     * is bucketed, see bBucketRenderTargetSize.
+     */
+    FIntPoint GetContentSize() const;
+
+    /**
+     * Called by widgets every frame they display us, lets UpdateRatePolicy
+     * pause the artboard once no widget does anymore
+     */
+    void MarkDisplayed() { LastDisplayTime = FPlatformTime::Seconds(); }
+
+    /**
+     * Whether our widget draws us straight into its window with
+     * GetSlateRenderCommands, see bDrawInSlate
+     */
+    bool IsDrawingInSlate() const { return bIsDrawingInSlate; }
+
+    /** Commands drawing our artboard in GetContentSize(), when in Slate */
+    const TArray<FRiveRenderCommand>& GetSlateRenderCommands() const
+    {
+        return SlateRenderCommands;
+    }
+
+    const TSharedPtr<IRiveRenderTarget>& GetRiveRenderTarget() const
+    {
+        return RiveRenderTarget;
+    }
+
+    /**
+     * Changes whenever widgets displaying us have to paint again: new Slate
+     * render commands, a new size or atlas slot. Frames drawn into the same
+     * texture show up without repainting.
+     */
+    uint32 GetDisplayVersion() const { return DisplayVersion; }
+
+    /** Called by our atlas page when our slot moves */
+    void InvalidateDisplay() { ++DisplayVersion; }
+
 protected:
     void OnRiveRendererInitialized(IRiveRenderer* InRiveRenderer);
     void OnResourceInitialized_RenderThread(
         FRHICommandListImmediate& RHICmdList,
         FTextureRHIRef& NewResource) const;
     void OnRiveFileInitialized(bool bSuccess);
+    void InitializeRenderTarget(IRiveRenderer* InRiveRenderer);
+    void ResizeOwnRenderTarget(const FIntPoint& InSize);
+    bool UpdateAtlasSlot(const FIntPoint& InSize);
+    void ReleaseAtlasSlot();
+    bool ShouldDrawInSlate() const;
+    void UpdateDrawInSlate();
+    void SubmitRenderCommands();
 
 public:
     UPROPERTY(EditAnywhere, Transient, Category = Rive)
@@ -139,8 +225,64 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Rive)
     FRiveDescriptor RiveDescriptor;
 
+    /**
+     * Draw into a slot of a shared atlas texture instead of a render target
+     * of our own, as long as we are no larger than r.rive.atlas.maxslotsize.
+     * Must be set before Initialize.
+     */
+    UPROPERTY(EditAnywhere,
+              BlueprintReadWrite,
+              Category = Rive,
+              AdvancedDisplay)
+    bool bUseSharedAtlas = false;
+
+    /**
+     * Allocate our render target in steps of r.rive.texture.resizebucket
+     * pixels and only draw into the requested size, so that continuous
+     * resizes rarely reallocate. Only for users going through
+     * GetDisplayUVRegion, such as Rive widgets.
+     */
+    UPROPERTY(EditAnywhere,
+              BlueprintReadWrite,
+              Category = Rive,
+              AdvancedDisplay)
+    bool bBucketRenderTargetSize = false;
+
+    /**
+     * Let our Rive widget draw the artboard straight into its window during
+     * the Slate render pass instead of into a render target of our own, which
+     * saves the texture and sampling it again. Only with the RHI renderer and
+     * windows whose back buffer allows unordered access, we fall back to a
+     * texture otherwise (r.rive.slate.directdraw). Ignored when in a shared
+     * atlas, or when displayed by anything else than a Rive widget.
+     */
+    UPROPERTY(EditAnywhere,
+              BlueprintReadWrite,
+              Category = Rive,
+              AdvancedDisplay)
+    bool bDrawInSlate = false;
+
+    /**
+     * Whether the Rive tick subsystem can defer us when over its per frame
+     * budget (r.rive.tick.budgetms)
+     */
+    UPROPERTY(EditAnywhere,
+              BlueprintReadWrite,
+              Category = Rive,
+              AdvancedDisplay)
+    ERiveTickPriority TickPriority = ERiveTickPriority::Normal;
+
+    /**
+     * Pauses the artboard when no widget displays us. Not applied while
+     * packed in a shared atlas, the page ticks all of its slots.
+     */
+    UPROPERTY(EditAnywhere,
+              BlueprintReadWrite,
+              Category = Rive,
+              AdvancedDisplay)
+    FRiveUpdateRatePolicy UpdateRatePolicy;
+
 private:
-    UFUNCTION()
     void OnArtboardTickRender(float DeltaTime, URiveArtboard* InArtboard);
 
     UFUNCTION()
@@ -154,6 +296,10 @@ private:
 
     TSharedPtr<IRiveRenderTarget> RiveRenderTarget;
 
+    /** Atlas page we are drawn into, if any */
+    UPROPERTY(Transient)
+    TObjectPtr<URiveTextureAtlas> Atlas;
+
     UPROPERTY(Transient,
               BlueprintReadOnly,
               Category = Rive,
@@ -170,4 +316,26 @@ private:
     void InitializeAudioEngine();
 
     FDelegateHandle AudioEngineLambdaHandle;
+
+    FRiveUpdateRateState UpdateRateState;
+
+    /** Requested size when bucketing, zero otherwise */
+    FIntPoint ContentSize = FIntPoint::ZeroValue;
+
+    /** Last time a widget displayed us, negative if none ever did */
+    double LastDisplayTime = -1.0;
+
+    bool bIsDrawingInSlate = false;
+
+    /** See GetDisplayVersion */
+    uint32 DisplayVersion = 0;
+
+    /** Whether the artboard was settled when we last took its commands */
+    bool bWasArtboardSettled = false;
+
+    /**
+     * Last commands recorded while in Slate, kept until the next tick as
+     * widgets can paint more often than we tick
+     */
+    TArray<FRiveRenderCommand> SlateRenderCommands;
 };
@@ -0,0 +1,110 @@
+// Copyright Rive, Inc. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/EngineBaseTypes.h"
+#include "Subsystems/EngineSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "RiveTickSubsystem.generated.h"
+
+class URiveArtboard;
+class UWorld;
+
+/**
+ * Order in which Rive objects are ticked by URiveTickSubsystem, and whether
+ * they can be deferred to a later frame when the tick budget is exceeded
+ */
+UENUM(BlueprintType)
+enum class ERiveTickPriority : uint8
+{
+    /** Deferred first when over budget */
+    Low,
+    Normal,
+    /** Always ticked, even when over budget */
+    High,
+};
+
+/**
+ * Something owning artboards that URiveTickSubsystem ticks. The artboards of
+ * every client are advanced together first, then each client draws.
+ */
+class RIVE_API IRiveTickClient
+{
+public:
+    virtual ~IRiveTickClient() = default;
+
+    /** Adds the artboards to advance this frame */
+    virtual void GatherArtboards(TArray<URiveArtboard*>& OutArtboards) = 0;
+
+    /** Draws the advanced artboards and submits them */
+    virtual void TickRender(float InDeltaSeconds) = 0;
+
+    virtual ERiveTickPriority GetTickPriority() const
+    {
+        return ERiveTickPriority::Normal;
+    }
+};
+
+/**
+ * Owns the ticking of every Rive artboard. Clients queue themselves when the
+ * engine ticks them, and the whole queue is processed once per world tick:
+ * clients are sorted by priority, their artboards advanced in parallel
+ * batches, then drawn. With r.rive.tick.budgetms set, clients that are not
+ * High priority are deferred to the next frame once the budget is spent, and
+ * receive the accumulated delta time when they finally tick.
+ */
+UCLASS()
+class RIVE_API URiveTickSubsystem : public UEngineSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    /**
+     * Returns the subsystem, or nullptr if centralized ticking is disabled
+     * (r.rive.tick.centralized 0) or the engine is not available yet
+     */
+    static URiveTickSubsystem* Get();
+
+    //~ BEGIN : USubsystem Interface
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+    //~ END : USubsystem Interface
+
+    /** Queues the client to be ticked with the rest of this frame's clients */
+    void QueueTick(UObject* InOwner,
+                   IRiveTickClient* InClient,
+                   float InDeltaSeconds);
+
+    /** Ticks every client queued so far */
+    void FlushPendingTicks();
+
+private:
+    void OnWorldTickEnd(UWorld* InWorld,
+                        ELevelTick InTickType,
+                        float InDeltaSeconds);
+    void OnEndFrame();
+
+    struct FPendingTick
+    {
+        TWeakObjectPtr<UObject> Owner;
+        IRiveTickClient* Client = nullptr;
+        float DeltaSeconds = 0.f;
+        ERiveTickPriority Priority = ERiveTickPriority::Normal;
+    };
+
+    struct FDeferredTick
+    {
+        float DeltaSeconds = 0.f;
+        int32 Frames = 0;
+    };
+
+    TArray<FPendingTick> PendingTicks;
+    TSet<TObjectKey<UObject>> PendingOwners;
+
+    /** Time and frame count owed to clients deferred by the budget */
+    TMap<TObjectKey<UObject>, FDeferredTick> DeferredTicks;
+
+    FDelegateHandle OnWorldTickEndHandle;
+    FDelegateHandle OnEndFrameHandle;
+};
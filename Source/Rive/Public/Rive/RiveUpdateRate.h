@@ -0,0 +1,76 @@
+// Copyright Rive, Inc. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "RiveUpdateRate.generated.h"
+
+/**
+ * Runtime state of an update rate policy, kept by whoever ticks the artboards
+ */
+struct FRiveUpdateRateState
+{
+    /** Time elapsed since the artboards were last ticked */
+    float AccumulatedSeconds = 0.f;
+};
+
+/**
+ * How often artboards are ticked depending on whether and how far away they
+ * are rendered. Near artboards tick every frame, farther ones at a reduced
+ * rate with the skipped time accumulated, and artboards not rendered for a
+ * while stop advancing altogether.
+ */
+USTRUCT(BlueprintType)
+struct RIVE_API FRiveUpdateRatePolicy
+{
+    GENERATED_BODY()
+
+    /** If false, always tick every frame. Opt-in, off by default. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Rive)
+    bool bEnabled = false;
+
+    /**
+     * Stop advancing once not rendered for this many seconds. Animations
+     * resume where they left off. Negative to never pause.
+     */
+    UPROPERTY(EditAnywhere,
+              BlueprintReadWrite,
+              Category = Rive,
+              meta = (EditCondition = "bEnabled"))
+    float PauseWhenNotRenderedFor = 0.5f;
+
+    /** Distance to the closest view, in cm, up to which we tick every frame */
+    UPROPERTY(EditAnywhere,
+              BlueprintReadWrite,
+              Category = Rive,
+              meta = (EditCondition = "bEnabled", ClampMin = 0, UIMin = 0))
+    float FullRateDistance = 1500.f;
+
+    /** Distance to the closest view, in cm, from which we tick at MinRate */
+    UPROPERTY(EditAnywhere,
+              BlueprintReadWrite,
+              Category = Rive,
+              meta = (EditCondition = "bEnabled", ClampMin = 0, UIMin = 0))
+    float MinRateDistance = 6000.f;
+
+    /** Ticks per second at MinRateDistance and beyond */
+    UPROPERTY(EditAnywhere,
+              BlueprintReadWrite,
+              Category = Rive,
+              meta = (EditCondition = "bEnabled", ClampMin = 1, UIMin = 1))
+    float MinRate = 10.f;
+
+    /**
+     * Decides whether to tick this frame
+     * @param InSecondsSinceRendered Time since the artboards were last seen,
+     * 0 if unknown
+     * @param InDistance Distance to the closest view, 0 if unknown
+     * @param OutDeltaSeconds Time to tick with, including the skipped frames
+     * @return false if the tick should be skipped
+     */
+    bool ShouldTick(FRiveUpdateRateState& InOutState,
+                    float InDeltaSeconds,
+                    float InSecondsSinceRendered,
+                    float InDistance,
+                    float& OutDeltaSeconds) const;
+};
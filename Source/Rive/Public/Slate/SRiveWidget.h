@@ -35,13 +35,39 @@ public:
     virtual void OnArrangeChildren(
         const FGeometry& AllottedGeometry,
         FArrangedChildren& ArrangedChildren) const override;
+    virtual void Tick(const FGeometry& AllottedGeometry,
+                      const double InCurrentTime,
+                      const float InDeltaTime) override;
+    virtual int32 OnPaint(const FPaintArgs& Args,
+                          const FGeometry& AllottedGeometry,
+                          const FSlateRect& MyCullingRect,
+                          FSlateWindowElementList& OutDrawElements,
+                          int32 LayerId,
+                          const FWidgetStyle& InWidgetStyle,
+                          bool bParentEnabled) const override;
 
     void SetRiveTexture(URiveTexture* InRiveTexture);
     FVector2D GetSize();
 
+    /**
+     * Whether our size drives the size of our texture. Off for textures
+     * shared with other widgets, which get scaled instead.
+     */
+    void SetResizesTexture(bool bInResizesTexture)
+    {
+        bResizesTexture = bInResizesTexture;
+    }
+
 private:
     UWorld* GetWorld() const;
     void OnResize() const;
+    void UpdateBrushFromAtlas() const;
+
+    /** Adds the element drawing our texture object straight into the window */
+    int32 PaintInSlate(const FGeometry& AllottedGeometry,
+                       const FSlateRect& MyCullingRect,
+                       FSlateWindowElementList& OutDrawElements,
+                       int32 LayerId) const;
 
     URiveTexture* RiveTexture = nullptr;
     TArray<URiveArtboard*> Artboards;
@@ -49,6 +75,11 @@ private:
     TSharedPtr<SImage> RiveImageView;
     TSharedPtr<FSlateBrush> RiveTextureBrush;
 
+    bool bResizesTexture = true;
+
+    /** Display version of our texture object when we last painted */
+    mutable uint32 PaintedDisplayVersion = 0;
+
     double LastSizeChangeTime = 0;
     mutable FTimerHandle TimerHandle;
     mutable FVector2D PreviousSize;
@@ -77,15 +77,37 @@ public:
     UPROPERTY(BlueprintReadOnly, EditAnywhere, Category = Rive)
     FRiveDescriptor RiveDescriptor;
 
+    /**
+     * Pack this widget into a texture shared with other small Rive widgets
+     * instead of giving it a render target of its own. Widgets larger than
+     * r.rive.atlas.maxslotsize fall back to their own render target.
+     */
+    UPROPERTY(BlueprintReadOnly, EditAnywhere, Category = Rive, AdvancedDisplay)
+    bool bUseSharedAtlas = false;
+
     UFUNCTION(BlueprintCallable, Category = Rive)
     void SetRiveDescriptor(const FRiveDescriptor& newDescriptor);
 
+    /**
+     * Texture object to display instead of creating one of our own, e.g. a
+     * Rive Texture Object asset. Widgets showing the same one draw its
+     * artboard once for all of them, and share its state and input. We
+     * neither resize nor destroy it, RiveDescriptor is ignored.
+     */
+    UPROPERTY(BlueprintReadOnly, EditAnywhere, Category = Rive, AdvancedDisplay)
+    TObjectPtr<URiveTextureObject> SharedTextureObject;
+
+    UFUNCTION(BlueprintCallable, Category = Rive)
+    void SetSharedTextureObject(URiveTextureObject* InTextureObject);
+
 #if WITH_EDITOR
     virtual void PostEditChangeChainProperty(
         FPropertyChangedChainEvent& PropertyChangedEvent) override;
 #endif
 private:
     void Setup();
+    void CreateTextureObject();
+    void ReleaseTextureObject();
 
     UFUNCTION()
     void OnRiveObjectReady();
@@ -108,4 +130,7 @@ private:
 
     FVector2f InitialArtboardSize;
     bool IsChangingFromLayout = false;
+
+    /** False when RiveTextureObject is a SharedTextureObject */
+    bool bOwnsTextureObject = true;
 };
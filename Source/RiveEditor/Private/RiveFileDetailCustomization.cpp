@@ -5,80 +5,44 @@
 #include "DetailLayoutBuilder.h"
 #include "DetailWidgetRow.h"
 #include "Logs/RiveEditorLog.h"
-#include "Rive/RiveArtboard.h"
 #include "Rive/RiveFile.h"
-#include "rive/animation/state_machine_input_instance.hpp"
 #include "Styling/SlateStyleMacros.h"
-#include <string>
 
 #include "EditorFontGlyphs.h"
 
-THIRD_PARTY_INCLUDES_START
-#include "rive/animation/state_machine_input.hpp"
-#include "rive/animation/state_machine_input_instance.hpp"
-#include "rive/generated/animation/state_machine_bool_base.hpp"
-#include "rive/generated/animation/state_machine_number_base.hpp"
-#include "rive/generated/animation/state_machine_trigger_base.hpp"
-THIRD_PARTY_INCLUDES_END
-
 #define LOCTEXT_NAMESPACE "RiveArtboardDetailCustomization"
 
 namespace RiveArtboardDetailCustomizationPrivate
 {
-static bool IsTrigger(rive::SMIInput* Input)
-{
-    return Input->input()->is<rive::StateMachineTriggerBase>();
-}
-
-static bool IsNumber(rive::SMIInput* Input)
-{
-    return Input->input()->is<rive::StateMachineNumberBase>();
-}
-
-static bool IsBool(rive::SMIInput* Input)
-{
-    return Input->input()->is<rive::StateMachineBoolBase>();
-}
-
-static FLinearColor GetColorForInput(rive::SMIInput* Input)
+static FLinearColor GetColorForInput(ERiveInputType InType)
 {
     // colors retrieved from PropertyHelpers
-    if (IsBool(Input))
+    switch (InType)
     {
-        return FLinearColor(0.300000f, 0.0f, 0.0f, 1.0f);
+        case ERiveInputType::Bool:
+            return FLinearColor(0.300000f, 0.0f, 0.0f, 1.0f);
+        case ERiveInputType::Number:
+            return FLinearColor(0.357667f, 1.0f, 0.060000f, 1.0f);
+        case ERiveInputType::Trigger:
+            return FLinearColor(0.0f, 0.349f, 0.79f, 1.0f);
+        default:
+            return FLinearColor::White;
     }
-
-    if (IsNumber(Input))
-    {
-        return FLinearColor(0.357667f, 1.0f, 0.060000f, 1.0f);
-    }
-
-    if (IsTrigger(Input))
-    {
-        return FLinearColor(0.0f, 0.349f, 0.79f, 1.0f);
-    }
-
-    return FLinearColor::White;
 }
 
-static FString GetTypeStringForInput(rive::SMIInput* Input)
+static FString GetTypeStringForInput(ERiveInputType InType)
 {
-    if (IsBool(Input))
-    {
-        return FString("Bool");
-    }
-
-    if (IsNumber(Input))
-    {
-        return FString("Number");
-    }
-
-    if (IsTrigger(Input))
+    switch (InType)
     {
-        return FString("Trigger");
+        case ERiveInputType::Bool:
+            return FString("Bool");
+        case ERiveInputType::Number:
+            return FString("Number");
+        case ERiveInputType::Trigger:
+            return FString("Trigger");
+        default:
+            return FString("Unknown");
     }
-
-    return FString("Unknown");
 }
 } // namespace RiveArtboardDetailCustomizationPrivate
 
@@ -93,13 +57,10 @@ void FRiveFileDetailCustomization::CustomizeDetails(
 
     // Find the property you want to customize
     TSharedRef<IPropertyHandle> MyProperty = DetailBuilder.GetProperty(
-        GET_MEMBER_NAME_CHECKED(URiveFile, Artboards));
+        GET_MEMBER_NAME_CHECKED(URiveFile, ArtboardInfos));
 
     IDetailCategoryBuilder& MyCategory = DetailBuilder.EditCategory("Rive");
 
-    const TAttribute<bool> EditCondition =
-        TAttribute<bool>::Create([this]() { return false; });
-
     MyCategory.AddProperty(MyProperty)
         .CustomWidget(false)
         .WholeRowContent()[SNew(SHorizontalBox) +
@@ -109,135 +70,102 @@ void FRiveFileDetailCustomization::CustomizeDetails(
                                         .Font(DEFAULT_FONT("Regular", 8))
                                         .Text(FText::FromString("Artboards"))]];
 
-    uint32 NumElements;
-    MyProperty->GetNumChildren(NumElements);
-
-    for (uint32 Index = 0; Index < NumElements; ++Index)
+    // The saved artboard infos are listed as they are, no need to initialize
+    // the file or instance any of its artboards
+    TArray<TWeakObjectPtr<UObject>> Objects;
+    DetailBuilder.GetObjectsBeingCustomized(Objects);
+    const URiveFile* RiveFile =
+        Objects.Num() == 1 ? Cast<URiveFile>(Objects[0].Get()) : nullptr;
+    if (!RiveFile)
     {
-        TSharedRef<IPropertyHandle> ElementHandle =
-            MyProperty->GetChildHandle(Index).ToSharedRef();
+        return;
+    }
 
-        UObject* Object = nullptr;
-        if (ElementHandle->GetValue(Object) == FPropertyAccess::Success)
+    for (const FRiveArtboardInfo& ArtboardInfo : RiveFile->ArtboardInfos)
+    {
+        MyCategory.AddCustomRow(FText::FromString(ArtboardInfo.Name))
+            .WholeRowContent()
+                [SNew(SHorizontalBox) +
+                 SHorizontalBox::Slot()
+                     .VAlign(VAlign_Center)
+                     .Padding(10.f, 0.f, 0.f, 0.f)
+                     .AutoWidth()[SNew(STextBlock)
+                                      .Font(FAppStyle::Get().GetFontStyle(
+                                          "FontAwesome.11"))
+                                      .Text(FText::FromString(
+                                          FString(TEXT("\xf247"))))
+                                      .ToolTipText(FText::FromString(
+                                          TEXT("Artboard")))] +
+                 SHorizontalBox::Slot()
+                     .VAlign(VAlign_Center)
+                     .Padding(10.f, 0.f)
+                     .AutoWidth()[SNew(SEditableTextBox)
+                                      .IsReadOnly(true)
+                                      .Font(DEFAULT_FONT("Mono", 8))
+                                      .Text(FText::FromString(
+                                          ArtboardInfo.Name))]];
+
+        for (const FRiveStateMachineInfo& StateMachineInfo :
+             ArtboardInfo.StateMachines)
         {
-            if (URiveArtboard* Artboard = Cast<URiveArtboard>(Object))
-            {
-                MyCategory.AddProperty(ElementHandle)
-                    .CustomWidget()
-                    .WholeRowContent()
-                        [SNew(SHorizontalBox) +
-                         SHorizontalBox::Slot()
-                             .VAlign(VAlign_Center)
-                             .Padding(10.f, 0.f, 0.f, 0.f)
-                             .AutoWidth()[SNew(STextBlock)
-                                              .Font(
-                                                  FAppStyle::Get().GetFontStyle(
-                                                      "FontAwesome.11"))
-                                              .Text(FText::FromString(
-                                                  FString(TEXT("\xf247"))))
-                                              .ToolTipText(FText::FromString(
-                                                  TEXT("Artboard")))] +
-                         SHorizontalBox::Slot()
-                             .VAlign(VAlign_Center)
-                             .Padding(10.f, 0.f)
-                             .AutoWidth()[SNew(SEditableTextBox)
-                                              .IsReadOnly(true)
-                                              .Font(DEFAULT_FONT("Mono", 8))
-                                              .Text(FText::FromString(
-                                                  Artboard
-                                                      ->GetArtboardName()))]];
-
-                for (auto StateMachineName : Artboard->GetStateMachineNames())
-                {
-                    TUniquePtr<FRiveStateMachine> StateMachine =
-                        MakeUnique<FRiveStateMachine>(
-                            Artboard->GetNativeArtboard(),
-                            StateMachineName);
-                    uint32 StateMachineInputCount =
-                        StateMachine->GetInputCount();
-
-                    MyCategory.AddProperty(ElementHandle)
-                        .CustomWidget()
-                        .WholeRowContent()
-                            [SNew(SHorizontalBox) +
-                             SHorizontalBox::Slot()
-                                 .VAlign(VAlign_Center)
-                                 .Padding(20.f, 0.f, 0.f, 0.f)
-                                 .AutoWidth()
-                                     [SNew(STextBlock)
+            MyCategory.AddCustomRow(FText::FromString(StateMachineInfo.Name))
+                .WholeRowContent()
+                    [SNew(SHorizontalBox) +
+                     SHorizontalBox::Slot()
+                         .VAlign(VAlign_Center)
+                         .Padding(20.f, 0.f, 0.f, 0.f)
+                         .AutoWidth()[SNew(STextBlock)
                                           .Font(FAppStyle::Get().GetFontStyle(
                                               "FontAwesome.11"))
                                           .Text(FText::FromString(
                                               FString(TEXT("\xf0e8"))))
                                           .ToolTipText(FText::FromString(
                                               TEXT("StateMachine")))] +
-                             SHorizontalBox::Slot()
-                                 .VAlign(VAlign_Center)
-                                 .Padding(10.f, 0.f)
-                                 .AutoWidth()[SNew(SEditableTextBox)
-                                                  .IsReadOnly(true)
-                                                  .Font(DEFAULT_FONT("Mono", 8))
-                                                  .Text(FText::FromString(
-                                                      StateMachineName))]];
-
-                    for (uint32 InputI = 0; InputI < StateMachineInputCount;
-                         InputI++)
-                    {
-                        rive::SMIInput* Input = StateMachine->GetInput(InputI);
-                        FString TypeString =
-                            RiveArtboardDetailCustomizationPrivate::
-                                GetTypeStringForInput(Input);
-                        FLinearColor TypeColor =
-                            RiveArtboardDetailCustomizationPrivate::
-                                GetColorForInput(Input);
-                        // std::string InputName = Input->name();
+                     SHorizontalBox::Slot()
+                         .VAlign(VAlign_Center)
+                         .Padding(10.f, 0.f)
+                         .AutoWidth()[SNew(SEditableTextBox)
+                                          .IsReadOnly(true)
+                                          .Font(DEFAULT_FONT("Mono", 8))
+                                          .Text(FText::FromString(
+                                              StateMachineInfo.Name))]];
 
-                        FString InputName(UTF8_TO_TCHAR(Input->name().c_str()));
-                        MyCategory.AddProperty(ElementHandle)
-                            .CustomWidget()
-                            .WholeRowContent()
-                                [SNew(SHorizontalBox)
-                                 // +SHorizontalBox::Slot()
-                                 // 	.VAlign(VAlign_Center)
-                                 // 	.Padding(20.f, 0.f, 0.f, 0.f)
-                                 // 	.AutoWidth()
-                                 // 	[
-                                 // 	SNew(STextBlock)
-                                 // 		.Font(FAppStyle::Get().GetFontStyle("FontAwesome.11"))
-                                 // 		.Text(FText::FromString(FString(TEXT("\xf11c"))))//FText::FromString(ElementHandle->GetProperty()
-                                 //
-                                 // 	]
-                                 + SHorizontalBox::Slot()
-                                       .VAlign(VAlign_Center)
-                                       .Padding(30.f, 0.f, 0.f, 0.f)
-                                       .AutoWidth()
-                                           [SNew(SImage)
-                                                .ColorAndOpacity(TypeColor)
-                                                .Image(FAppStyle::GetBrush(
-                                                    "Kismet.VariableList."
-                                                    "TypeIcon"))] +
-                                 SHorizontalBox::Slot()
-                                     .VAlign(VAlign_Center)
-                                     .Padding(5.f, 0.f)
-                                     .AutoWidth()
-                                         [SNew(STextBlock)
+            for (const FRiveInputInfo& InputInfo : StateMachineInfo.Inputs)
+            {
+                const FString TypeString =
+                    RiveArtboardDetailCustomizationPrivate::
+                        GetTypeStringForInput(InputInfo.Type);
+                const FLinearColor TypeColor =
+                    RiveArtboardDetailCustomizationPrivate::GetColorForInput(
+                        InputInfo.Type);
+
+                MyCategory.AddCustomRow(FText::FromString(InputInfo.Name))
+                    .WholeRowContent()
+                        [SNew(SHorizontalBox) +
+                         SHorizontalBox::Slot()
+                             .VAlign(VAlign_Center)
+                             .Padding(30.f, 0.f, 0.f, 0.f)
+                             .AutoWidth()[SNew(SImage)
+                                              .ColorAndOpacity(TypeColor)
+                                              .Image(FAppStyle::GetBrush(
+                                                  "Kismet.VariableList."
+                                                  "TypeIcon"))] +
+                         SHorizontalBox::Slot()
+                             .VAlign(VAlign_Center)
+                             .Padding(5.f, 0.f)
+                             .AutoWidth()[SNew(STextBlock)
                                               .Font(DEFAULT_FONT("Mono", 8))
                                               .ColorAndOpacity(TypeColor)
                                               .Text(FText::FromString(
-                                                  TypeString)) // FText::FromString(ElementHandle->GetProperty()
-                        ] +
-                                 SHorizontalBox::Slot()
-                                     .VAlign(VAlign_Center)
-                                     .Padding(5.f, 0.f)
-                                     .AutoWidth()
-                                         [SNew(SEditableTextBox)
+                                                  TypeString))] +
+                         SHorizontalBox::Slot()
+                             .VAlign(VAlign_Center)
+                             .Padding(5.f, 0.f)
+                             .AutoWidth()[SNew(SEditableTextBox)
                                               .IsReadOnly(true)
                                               .Font(DEFAULT_FONT("Mono", 8))
                                               .Text(FText::FromString(
-                                                  InputName)) // FText::FromString(ElementHandle->GetProperty()
-                        ]];
-                    }
-                }
+                                                  InputInfo.Name))]];
             }
         }
     }
@@ -12,12 +12,15 @@
 #endif
 
 #include "RenderGraphUtils.h"
+#include "IRiveRenderer.h"
+#include "IRiveRendererModule.h"
 #include "Logs/RiveRendererLog.h"
 
 #include "HAL/IConsoleManager.h"
 
 #include "Containers/ResourceArray.h"
 #include "RHIStaticStates.h"
+#include "TextureResource.h"
 #include "Modules/ModuleManager.h"
 
 #include "RenderGraphHelpers/RivePassFunctions.h"
@@ -441,19 +444,59 @@ public:
             imageData.GetData());
     }
 
+    /** Samples a texture owned by the engine, see setTextureReference */
+    TextureRHIImpl(uint32_t width, uint32_t height) : Texture(width, height)
+    {}
+
+    /**
+     * Follows the texture the reference points to, which streaming swaps as
+     * mips come and go. Rendering thread only.
+     */
+    void setTextureReference(FRHITextureReference* textureReference)
+    {
+        check(IsInRenderingThread());
+        m_textureReference = textureReference;
+    }
+
     FRDGTextureRef asRDGTexture(FRDGBuilder& Builder) const
     {
-        check(m_texture);
+        FRHITexture* texture = contents();
+        if (texture == nullptr)
+        {
+            // An engine texture whose resource isn't there yet
+            check(m_textureReference);
+            texture = GBlackTexture->TextureRHI;
+        }
         return Builder.RegisterExternalTexture(
-            CreateRenderTarget(m_texture, TEXT("rive.PLSTextureRHIImpl_")));
+            CreateRenderTarget(texture, TEXT("rive.PLSTextureRHIImpl_")));
+    }
+
+    /**
+     * Views the texture with its linear format, so that sRGB engine textures
+     * are sampled with their encoded values, like decoded images
+     */
+    FRDGTextureSRVRef asRDGTextureSRV(FRDGBuilder& Builder) const
+    {
+        FRDGTextureSRVDesc Desc =
+            FRDGTextureSRVDesc::Create(asRDGTexture(Builder));
+        Desc.SRGBOverride = SRGBO_ForceDisable;
+        return Builder.CreateSRV(Desc);
     }
 
     virtual ~TextureRHIImpl() override {}
 
-    FTextureRHIRef contents() const { return m_texture; }
+    FRHITexture* contents() const
+    {
+        if (m_textureReference)
+        {
+            return m_textureReference->GetReferencedTexture();
+        }
+        return m_texture;
+    }
 
 private:
     FTextureRHIRef m_texture;
+    FTextureReferenceRHIRef m_textureReference;
 };
 #else // UE VERSION > 5_5:
 // FRHIAsyncCommandList was removed in 5.5 we should probably defer load these
@@ -513,19 +556,59 @@ public:
             imageData.GetData());
     }
 
+    /** Samples a texture owned by the engine, see setTextureReference */
+    TextureRHIImpl(uint32_t width, uint32_t height) : Texture(width, height)
+    {}
+
+    /**
+     * Follows the texture the reference points to, which streaming swaps as
+     * mips come and go. Rendering thread only.
+     */
+    void setTextureReference(FRHITextureReference* textureReference)
+    {
+        check(IsInRenderingThread());
+        m_textureReference = textureReference;
+    }
+
     FRDGTextureRef asRDGTexture(FRDGBuilder& Builder) const
     {
-        check(m_texture);
+        FRHITexture* texture = contents();
+        if (texture == nullptr)
+        {
+            // An engine texture whose resource isn't there yet
+            check(m_textureReference);
+            texture = GBlackTexture->TextureRHI;
+        }
         return Builder.RegisterExternalTexture(
-            CreateRenderTarget(m_texture, TEXT("rive.PLSTextureRHIImpl_")));
+            CreateRenderTarget(texture, TEXT("rive.PLSTextureRHIImpl_")));
+    }
+
+    /**
+     * Views the texture with its linear format, so that sRGB engine textures
+     * are sampled with their encoded values, like decoded images
+     */
+    FRDGTextureSRVRef asRDGTextureSRV(FRDGBuilder& Builder) const
+    {
+        FRDGTextureSRVDesc Desc =
+            FRDGTextureSRVDesc::Create(asRDGTexture(Builder));
+        Desc.SRGBOverride = SRGBO_ForceDisable;
+        return Builder.CreateSRV(Desc);
     }
 
     virtual ~TextureRHIImpl() override {}
 
-    FTextureRHIRef contents() const { return m_texture; }
+    FRHITexture* contents() const
+    {
+        if (m_textureReference)
+        {
+            return m_textureReference->GetReferencedTexture();
+        }
+        return m_texture;
+    }
 
 private:
     FTextureRHIRef m_texture;
+    FTextureReferenceRHIRef m_textureReference;
 };
 #endif
 
@@ -546,6 +629,11 @@ RenderTargetRHI::RenderTargetRHI(FRHICommandList& RHICmdList,
     m_textureTarget(InTextureTarget),
     m_capabilities(Capabilities)
 {
+    // Coverage and clip textures are pooled with the target textures, so
+    // that recreated render targets of the same size reuse them
+    IRiveRenderer* RiveRenderer = IRiveRendererModule::Get().GetRenderer();
+    check(RiveRenderer);
+
     FRHITextureCreateDesc coverageDesc =
         FRHITextureCreateDesc::Create2D(TEXT("rive.AtomicCoverage"),
                                         width(),
@@ -553,7 +641,9 @@ RenderTargetRHI::RenderTargetRHI(FRHICommandList& RHICmdList,
                                         PF_R32_UINT);
     coverageDesc.SetNumMips(1);
     coverageDesc.AddFlags(ETextureCreateFlags::UAV);
-    m_atomicCoverageTexture = CREATE_TEXTURE(RHICmdList, coverageDesc);
+    m_atomicCoverageTexture =
+        RiveRenderer->CreatePooledTexture_RenderThread(RHICmdList,
+                                                       coverageDesc);
 
     FRHITextureCreateDesc clipDesc =
         FRHITextureCreateDesc::Create2D(TEXT("rive.Clip"),
@@ -562,7 +652,8 @@ RenderTargetRHI::RenderTargetRHI(FRHICommandList& RHICmdList,
                                         PF_R32_UINT);
     clipDesc.SetNumMips(1);
     clipDesc.AddFlags(ETextureCreateFlags::UAV);
-    m_clipTexture = CREATE_TEXTURE(RHICmdList, clipDesc);
+    m_clipTexture =
+        RiveRenderer->CreatePooledTexture_RenderThread(RHICmdList, clipDesc);
 
     m_targetTextureSupportsUAV = static_cast<bool>(
         m_textureTarget->GetDesc().Flags & ETextureCreateFlags::UAV);
@@ -945,6 +1036,34 @@ rcp<Texture> RenderContextRHIImpl::decodeImageTexture(
     }
 }
 
+rcp<Texture> RenderContextRHIImpl::makeImageTexture(
+    uint32_t width,
+    uint32_t height,
+    const TArray<uint8>& imageDataBGRA)
+{
+    if (imageDataBGRA.Num() != static_cast<int64>(width) * height * 4)
+    {
+        return nullptr;
+    }
+    return make_rcp<TextureRHIImpl>(width, height, 1, imageDataBGRA);
+}
+
+rcp<Texture> RenderContextRHIImpl::makeImageTexture(
+    uint32_t width,
+    uint32_t height,
+    const FTextureReference* textureReference)
+{
+    rcp<TextureRHIImpl> texture = make_rcp<TextureRHIImpl>(width, height);
+
+    // The reference is created on the rendering thread, and only released
+    // there after this, when its texture goes away
+    ENQUEUE_RENDER_COMMAND(RiveSetImageTextureReference)
+    ([texture, textureReference](FRHICommandListImmediate&) {
+        texture->setTextureReference(textureReference->TextureReferenceRHI);
+    });
+    return texture;
+}
+
 void RenderContextRHIImpl::resizeFlushUniformBuffer(size_t sizeInBytes)
 {
     m_flushUniformBuffer.reset();
@@ -1657,7 +1776,7 @@ void RenderContextRHIImpl::flush(const FlushDescriptor& desc)
                             imageDrawUniforms;
 
                         PassParameters->PS.GLSL_imageTexture_raw =
-                            imageTexture->asRDGTexture(GraphBuilder);
+                            imageTexture->asRDGTextureSRV(GraphBuilder);
 
                         CommonPassParameters->VertexDeclarationRHI =
                             VertexDeclarations[static_cast<int32>(
@@ -1707,7 +1826,7 @@ void RenderContextRHIImpl::flush(const FlushDescriptor& desc)
                             imageDrawUniforms;
 
                         PassParameters->PS.GLSL_imageTexture_raw =
-                            imageTexture->asRDGTexture(GraphBuilder);
+                            imageTexture->asRDGTextureSRV(GraphBuilder);
 
                         CommonPassParameters->VertexDeclarationRHI =
                             VertexDeclarations[static_cast<int32>(
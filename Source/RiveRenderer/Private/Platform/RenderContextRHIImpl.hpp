@@ -12,6 +12,8 @@ THIRD_PARTY_INCLUDES_START
 #include "rive/renderer/buffer_ring.hpp"
 THIRD_PARTY_INCLUDES_END
 
+class FTextureReference;
+
 struct RHICapabilities
 {
     RHICapabilities();
@@ -258,6 +260,21 @@ public:
     virtual rive::rcp<rive::gpu::Texture> decodeImageTexture(
         rive::Span<const uint8_t> encodedBytes) override;
 
+    /** Image texture from pixels decoded by the caller, BGRA8 */
+    rive::rcp<rive::gpu::Texture> makeImageTexture(
+        uint32_t width,
+        uint32_t height,
+        const TArray<uint8>& imageDataBGRA);
+
+    /**
+     * Image texture sampling an engine texture in place, whichever its format
+     * and resident mips
+     */
+    rive::rcp<rive::gpu::Texture> makeImageTexture(
+        uint32_t width,
+        uint32_t height,
+        const FTextureReference* textureReference);
+
     virtual void resizeFlushUniformBuffer(size_t sizeInBytes) override;
     virtual void resizeImageDrawUniformBuffer(size_t sizeInBytes) override;
     virtual void resizePathBuffer(size_t sizeInBytes,
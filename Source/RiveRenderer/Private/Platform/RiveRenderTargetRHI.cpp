@@ -62,6 +62,49 @@ void FRiveRenderTargetRHI::CacheTextureTarget_RenderThread(
 #endif
 }
 
+#if WITH_RIVE
+bool FRiveRenderTargetRHI::DrawInto_RenderThread(
+    FRHICommandListImmediate& RHICmdList,
+    const FTextureRHIRef& InTexture,
+    const TArray<FRiveRenderCommand>& InRenderCommands)
+{
+    check(IsInRenderingThread());
+
+    // Same requirements as the textures we create ourselves
+    if (!InTexture.IsValid() || InTexture->GetFormat() != PF_R8G8B8A8 ||
+        !EnumHasAnyFlags(InTexture->GetFlags(), ETextureCreateFlags::UAV))
+    {
+        return false;
+    }
+
+    FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
+
+    rive::gpu::RenderContext* PLSRenderContext =
+        RiveRenderer->GetRenderContext();
+    if (PLSRenderContext == nullptr)
+    {
+        // Not the texture's fault, we just can't draw anything yet
+        return true;
+    }
+
+    // Back buffers rotate, only the coverage of the last one is kept around,
+    // the render target pool has the others
+    if (!DrawIntoRenderTarget || DrawIntoRenderTarget->texture() != InTexture)
+    {
+        RenderContextRHIImpl* const PLSRenderContextImpl =
+            PLSRenderContext->static_impl_cast<RenderContextRHIImpl>();
+        DrawIntoRenderTarget =
+            PLSRenderContextImpl->makeRenderTarget(RHICmdList, InTexture);
+    }
+
+    TGuardValue<bool> DrawingIntoGuard(bIsDrawingInto, true);
+    TGuardValue<bool> PreserveGuard(bPreserveContents, true);
+    RenderFrame_Internal(InRenderCommands);
+
+    return true;
+}
+#endif // WITH_RIVE
+
 void FRiveRenderTargetRHI::Render_RenderThread(
     FRHICommandListImmediate& RHICmdList,
     const TArray<FRiveRenderCommand>& RiveRenderCommands)
@@ -71,5 +114,5 @@ void FRiveRenderTargetRHI::Render_RenderThread(
 
 rive::rcp<rive::gpu::RenderTarget> FRiveRenderTargetRHI::GetRenderTarget() const
 {
-    return CachedRenderTarget;
+    return bIsDrawingInto ? DrawIntoRenderTarget : CachedRenderTarget;
 }
\ No newline at end of file
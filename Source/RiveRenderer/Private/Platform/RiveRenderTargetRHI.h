@@ -16,6 +16,12 @@ public:
     virtual void CacheTextureTarget_RenderThread(
         FRHICommandListImmediate& RHICmdList,
         const FTextureRHIRef& InRHIResource) override;
+#if WITH_RIVE
+    virtual bool DrawInto_RenderThread(
+        FRHICommandListImmediate& RHICmdList,
+        const FTextureRHIRef& InTexture,
+        const TArray<FRiveRenderCommand>& InRenderCommands) override;
+#endif // WITH_RIVE
     //~ END : IRiveRenderTarget Interface
 
 #if WITH_RIVE
@@ -31,4 +37,11 @@ protected:
 private:
     TSharedRef<FRiveRendererRHI> RiveRenderer;
     rive::rcp<RenderTargetRHI> CachedRenderTarget;
+
+    /**
+     * Target of the last DrawInto_RenderThread, returned by GetRenderTarget
+     * instead of ours while bIsDrawingInto
+     */
+    rive::rcp<RenderTargetRHI> DrawIntoRenderTarget;
+    bool bIsDrawingInto = false;
 };
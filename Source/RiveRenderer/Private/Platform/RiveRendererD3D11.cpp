@@ -7,6 +7,9 @@
 #include "Logs/RiveRendererLog.h"
 #include "ProfilingDebugging/RealtimeGPUProfiler.h"
 #include "RiveRenderTargetD3D11.h"
+#include "Engine/Texture2DDynamic.h"
+#include "Stats/RiveRendererStats.h"
+#include "TextureResource.h"
 #include "Windows/D3D11ThirdParty.h"
 #include "D3D11RHIPrivate.h"
 
@@ -104,6 +107,52 @@ void FRiveRendererD3D11::CreateRenderContext_RenderThread(
     }
 }
 
+#if WITH_RIVE
+DECLARE_GPU_STAT_NAMED(RenderBatchD3D11,
+                       TEXT("FRiveRendererD3D11::RenderBatch"));
+void FRiveRendererD3D11::RenderBatch_RenderThread(
+    FRHICommandListImmediate& RHICmdList,
+    const TArray<FRiveRenderBatchItem>& InBatch)
+{
+    SCOPE_CYCLE_COUNTER(STAT_RiveRenderBatch);
+    SCOPED_GPU_STAT(RHICmdList, RenderBatchD3D11);
+    SCOPED_DRAW_EVENT(RHICmdList, RiveRenderBatch);
+    check(IsInRenderingThread());
+
+    TArray<FRHITransitionInfo> ToRTV;
+    TArray<FRHITransitionInfo> ToUAV;
+    ToRTV.Reserve(InBatch.Num());
+    ToUAV.Reserve(InBatch.Num());
+    for (const FRiveRenderBatchItem& Item : InBatch)
+    {
+        FTextureRHIRef TargetTexture =
+            Item.RenderTarget->GetRenderTargetTexture()
+                ->GetResource()
+                ->TextureRHI;
+        ToRTV.Emplace(TargetTexture, ERHIAccess::Unknown, ERHIAccess::RTV);
+        ToUAV.Emplace(TargetTexture, ERHIAccess::RTV, ERHIAccess::UAVGraphics);
+    }
+
+    // Same as FRiveRenderTargetD3D11::Render_RenderThread, but the DX state
+    // is only reset once around the whole batch instead of once per target
+    RHICmdList.Transition(ToRTV);
+    RHICmdList.EnqueueLambda(
+        [this, InBatch](FRHICommandListImmediate& RHICmdList) {
+            ResetDXState();
+            {
+                FScopeLock Lock(&ThreadDataCS);
+                for (const FRiveRenderBatchItem& Item : InBatch)
+                {
+                    Item.RenderTarget->RenderFrame_Internal(
+                        Item.RenderCommands);
+                }
+            }
+            ResetDXState();
+        });
+    RHICmdList.Transition(ToUAV);
+}
+#endif // WITH_RIVE
+
 void FRiveRendererD3D11::ResetDXState() const
 {
     check(IsInRenderingThread());
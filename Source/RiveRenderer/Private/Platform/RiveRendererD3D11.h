@@ -64,6 +64,12 @@ public:
         FRHICommandListImmediate& RHICmdList) override;
     //~ END : IRiveRenderer Interface
 
+#if WITH_RIVE
+    virtual void RenderBatch_RenderThread(
+        FRHICommandListImmediate& RHICmdList,
+        const TArray<FRiveRenderBatchItem>& InBatch) override;
+#endif // WITH_RIVE
+
     void ResetDXState() const;
 
 private:
@@ -11,6 +11,7 @@
 #include "Logs/RiveRendererLog.h"
 #include "OpenGLDrv.h"
 #include "ProfilingDebugging/RealtimeGPUProfiler.h"
+#include "Stats/RiveRendererStats.h"
 #include "TextureResource.h"
 #include "UObject/UObjectGlobals.h"
 
@@ -127,6 +128,26 @@ void FRiveRendererOpenGL::CreateRenderContext_RenderThread(
         });
 }
 
+void FRiveRendererOpenGL::RenderBatch_RenderThread(
+    FRHICommandListImmediate& RHICmdList,
+    const TArray<FRiveRenderBatchItem>& InBatch)
+{
+    RIVE_DEBUG_FUNCTION_INDENT;
+    SCOPE_CYCLE_COUNTER(STAT_RiveRenderBatch);
+    check(IsInRenderingThread());
+
+    // GL calls must happen on the RHI thread, so the whole batch is moved
+    // there in a single lambda
+    RHICmdList.EnqueueLambda(
+        [this, InBatch](FRHICommandListImmediate& RHICmdList) {
+            FScopeLock Lock(&ThreadDataCS);
+            for (const FRiveRenderBatchItem& Item : InBatch)
+            {
+                Item.RenderTarget->RenderFrame_Internal(Item.RenderCommands);
+            }
+        });
+}
+
 void FRiveRendererOpenGL::CreateRenderContext_GameThread()
 {
     RIVE_DEBUG_FUNCTION_INDENT;
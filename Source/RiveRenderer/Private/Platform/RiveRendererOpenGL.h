@@ -30,6 +30,10 @@ public:
         FRHICommandListImmediate& RHICmdList) override;
     //~ END : IRiveRenderer Interface
 
+    virtual void RenderBatch_RenderThread(
+        FRHICommandListImmediate& RHICmdList,
+        const TArray<FRiveRenderBatchItem>& InBatch) override;
+
     virtual rive::gpu::RenderContext* GetOrCreateRenderContext_Internal();
 #endif // WITH_RIVE
     static bool IsRHIOpenGL();
@@ -1,6 +1,7 @@
 #include "RiveRendererRHI.h"
 #include "RenderContextRHIImpl.hpp"
 #include "RiveRenderTargetRHI.h"
+#include "Engine/Texture2D.h"
 
 TSharedPtr<IRiveRenderTarget> FRiveRendererRHI::CreateTextureTarget_GameThread(
     const FName& InRiveName,
@@ -40,4 +41,47 @@ void FRiveRendererRHI::CreateRenderContext_RenderThread(
 #if WITH_RIVE
     RenderContext = RenderContextRHIImpl::MakeContext(RHICmdList);
 #endif // WITH_RIVE
-}
\ No newline at end of file
+}
+
+#if WITH_RIVE
+
+rive::rcp<rive::RenderImage> FRiveRendererRHI::MakeImage(
+    uint32 InWidth,
+    uint32 InHeight,
+    const TArray<uint8>& InPixelsBGRA8)
+{
+    if (!RenderContext)
+    {
+        return nullptr;
+    }
+
+    rive::rcp<rive::gpu::Texture> Texture =
+        RenderContext->static_impl_cast<RenderContextRHIImpl>()
+            ->makeImageTexture(InWidth, InHeight, InPixelsBGRA8);
+    if (!Texture)
+    {
+        return nullptr;
+    }
+    return rive::make_rcp<rive::RiveRenderImage>(std::move(Texture));
+}
+
+rive::rcp<rive::RenderImage> FRiveRendererRHI::MakeImageFromTexture(
+    UTexture2D* InTexture)
+{
+    check(IsInGameThread());
+
+    if (!RenderContext || !InTexture)
+    {
+        return nullptr;
+    }
+
+    // Sized like the full texture, streaming only changes what is sampled
+    rive::rcp<rive::gpu::Texture> Texture =
+        RenderContext->static_impl_cast<RenderContextRHIImpl>()
+            ->makeImageTexture(InTexture->GetSizeX(),
+                               InTexture->GetSizeY(),
+                               &InTexture->TextureReference);
+    return rive::make_rcp<rive::RiveRenderImage>(std::move(Texture));
+}
+
+#endif // WITH_RIVE
\ No newline at end of file
@@ -11,5 +11,14 @@ public:
     virtual void CreateRenderContext_RenderThread(
         FRHICommandListImmediate& RHICmdList) override;
     virtual void Flush(rive::gpu::RenderContext& context) {}
+#if WITH_RIVE
+    virtual bool CanMakeImage() const override { return true; }
+    virtual rive::rcp<rive::RenderImage> MakeImage(
+        uint32 InWidth,
+        uint32 InHeight,
+        const TArray<uint8>& InPixelsBGRA8) override;
+    virtual rive::rcp<rive::RenderImage> MakeImageFromTexture(
+        UTexture2D* InTexture) override;
+#endif // WITH_RIVE
     //~ END : IRiveRenderer Interface
 };
@@ -0,0 +1,141 @@
+// Copyright Rive, Inc. All rights reserved.
+
+#include "RiveRenderScheduler.h"
+
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "IRiveRendererModule.h"
+#include "Misc/CoreDelegates.h"
+#include "RenderingThread.h"
+#include "RiveRenderer.h"
+#include "Stats/RiveRendererStats.h"
+
+static TAutoConsoleVariable<int32> CVarRiveRenderScheduler(
+    TEXT("r.rive.scheduler"),
+    1,
+    TEXT("If non 0, Rive render targets submitted during a frame are sorted "
+         "and rendered together in a single render command.\n")
+        TEXT("  0: submit each render target on its own\n")
+            TEXT("  1: batch render targets per frame (default)"),
+    ECVF_Default);
+
+URiveRenderScheduler* URiveRenderScheduler::Get()
+{
+    if (GEngine == nullptr ||
+        CVarRiveRenderScheduler.GetValueOnGameThread() == 0)
+    {
+        return nullptr;
+    }
+
+    return GEngine->GetEngineSubsystem<URiveRenderScheduler>();
+}
+
+void URiveRenderScheduler::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    OnWorldTickEndHandle = FWorldDelegates::OnWorldTickEnd.AddUObject(
+        this,
+        &URiveRenderScheduler::OnWorldTickEnd);
+    OnEndFrameHandle = FCoreDelegates::OnEndFrame.AddUObject(
+        this,
+        &URiveRenderScheduler::OnEndFrame);
+}
+
+void URiveRenderScheduler::Deinitialize()
+{
+    FlushPendingRenderTargets();
+
+    FWorldDelegates::OnWorldTickEnd.Remove(OnWorldTickEndHandle);
+    FCoreDelegates::OnEndFrame.Remove(OnEndFrameHandle);
+
+    Super::Deinitialize();
+}
+
+void URiveRenderScheduler::QueueRenderTarget(
+    const TSharedRef<FRiveRenderTarget>& InRenderTarget,
+    const TArray<FRiveRenderCommand>& InRenderCommands)
+{
+    check(IsInGameThread());
+
+    // Same as FRiveRenderTarget::Render_Internal, empty frames are skipped to
+    // avoid rendering "blank" frames
+    if (InRenderCommands.IsEmpty())
+    {
+        return;
+    }
+
+    FRiveRenderBatchItem& Item = PendingBatch.AddDefaulted_GetRef();
+    Item.RenderTarget = InRenderTarget;
+    Item.RenderCommands = InRenderCommands;
+}
+
+void URiveRenderScheduler::FlushPendingRenderTargets()
+{
+    check(IsInGameThread());
+
+    if (PendingBatch.IsEmpty())
+    {
+        return;
+    }
+
+#if WITH_RIVE
+    IRiveRenderer* Renderer = IRiveRendererModule::IsAvailable()
+                                  ? IRiveRendererModule::Get().GetRenderer()
+                                  : nullptr;
+    if (Renderer == nullptr)
+    {
+        PendingBatch.Empty();
+        return;
+    }
+
+    // Group targets of the same size together so the render context can
+    // reuse its intermediate buffers between flushes. The sort is stable and
+    // keyed on the target as well, so several submissions of the same target
+    // in one frame keep their order.
+    PendingBatch.StableSort(
+        [](const FRiveRenderBatchItem& A, const FRiveRenderBatchItem& B) {
+            const uint32 WidthA = A.RenderTarget->GetWidth();
+            const uint32 WidthB = B.RenderTarget->GetWidth();
+            if (WidthA != WidthB)
+            {
+                return WidthA > WidthB;
+            }
+
+            const uint32 HeightA = A.RenderTarget->GetHeight();
+            const uint32 HeightB = B.RenderTarget->GetHeight();
+            if (HeightA != HeightB)
+            {
+                return HeightA > HeightB;
+            }
+
+            return A.RenderTarget.Get() < B.RenderTarget.Get();
+        });
+
+    INC_DWORD_STAT(STAT_RiveBatchesPerFrame);
+    INC_DWORD_STAT_BY(STAT_RiveTargetsPerFrame, PendingBatch.Num());
+
+    TSharedRef<FRiveRenderer> RiveRenderer =
+        StaticCastSharedRef<FRiveRenderer>(Renderer->AsShared());
+    ENQUEUE_RENDER_COMMAND(RiveRenderBatch)
+    ([RiveRenderer, Batch = MoveTemp(PendingBatch)](
+         FRHICommandListImmediate& RHICmdList) {
+        RiveRenderer->RenderBatch_RenderThread(RHICmdList, Batch);
+    });
+#endif // WITH_RIVE
+
+    PendingBatch.Reset();
+}
+
+void URiveRenderScheduler::OnWorldTickEnd(UWorld* InWorld,
+                                          ELevelTick InTickType,
+                                          float InDeltaSeconds)
+{
+    FlushPendingRenderTargets();
+}
+
+void URiveRenderScheduler::OnEndFrame()
+{
+    // Catches targets submitted outside of a world tick, e.g. from UMG
+    FlushPendingRenderTargets();
+}
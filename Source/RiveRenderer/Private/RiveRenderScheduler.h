@@ -0,0 +1,58 @@
+// Copyright Rive, Inc. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/EngineBaseTypes.h"
+#include "RiveRenderTarget.h"
+#include "Subsystems/EngineSubsystem.h"
+#include "RiveRenderScheduler.generated.h"
+
+class UWorld;
+
+/**
+ * Collects every Rive render target submitted during a game frame and renders
+ * them in a single render command. Targets are sorted so that targets sharing
+ * the same size run back to back, and the whole batch is drawn under a single
+ * hold of the renderer's ThreadDataCS.
+ */
+UCLASS()
+class URiveRenderScheduler : public UEngineSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    /**
+     * Returns the scheduler, or nullptr if batching is disabled
+     * (r.rive.scheduler 0) or the engine is not available yet
+     */
+    static URiveRenderScheduler* Get();
+
+    //~ BEGIN : USubsystem Interface
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+    //~ END : USubsystem Interface
+
+    /**
+     * Queues a copy of the given render commands to be drawn into the target
+     * with the rest of this frame's batch
+     */
+    void QueueRenderTarget(const TSharedRef<FRiveRenderTarget>& InRenderTarget,
+                           const TArray<FRiveRenderCommand>& InRenderCommands);
+
+    /**
+     * Sends every target queued so far to the rendering thread as one batch
+     */
+    void FlushPendingRenderTargets();
+
+private:
+    void OnWorldTickEnd(UWorld* InWorld,
+                        ELevelTick InTickType,
+                        float InDeltaSeconds);
+    void OnEndFrame();
+
+    TArray<FRiveRenderBatchItem> PendingBatch;
+
+    FDelegateHandle OnWorldTickEndHandle;
+    FDelegateHandle OnEndFrameHandle;
+};
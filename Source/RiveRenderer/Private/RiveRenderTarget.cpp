@@ -3,6 +3,7 @@
 #include "RiveRenderTarget.h"
 
 #include "RiveRenderer.h"
+#include "RiveRenderScheduler.h"
 #include "Engine/Texture2DDynamic.h"
 #include "Logs/RiveRendererLog.h"
 #include "RenderingThread.h"
@@ -10,6 +11,8 @@
 
 THIRD_PARTY_INCLUDES_START
 #include "rive/artboard.hpp"
+#include "rive/math/raw_path.hpp"
+#include "rive/renderer/render_context.hpp"
 #include "rive/renderer/rive_renderer.hpp"
 #include "rive/renderer/render_target.hpp"
 
@@ -53,7 +56,15 @@ void FRiveRenderTarget::Submit()
 {
     check(IsInGameThread());
 
-    FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
+    // When batching is enabled, the scheduler renders every target queued
+    // this frame in a single render command
+    if (URiveRenderScheduler* Scheduler = URiveRenderScheduler::Get())
+    {
+        Scheduler->QueueRenderTarget(
+            StaticCastSharedRef<FRiveRenderTarget>(AsShared()),
+            RenderCommands);
+        return;
+    }
 
     // Making a copy of the RenderCommands to be processed on RenderingThread
     ENQUEUE_RENDER_COMMAND(Render)
@@ -106,10 +117,22 @@ void FRiveRenderTarget::Translate(const FVector2f& InVector)
     RenderCommands.Push(RenderCommand);
 }
 
-void FRiveRenderTarget::Draw(rive::Artboard* InArtboard)
+void FRiveRenderTarget::ClipRect(const FBox2f& InRect)
+{
+    FRiveRenderCommand RenderCommand(ERiveRenderCommandType::ClipPath);
+    RenderCommand.TX = InRect.Min.X;
+    RenderCommand.TY = InRect.Min.Y;
+    RenderCommand.X2 = InRect.Max.X;
+    RenderCommand.Y2 = InRect.Max.Y;
+    RenderCommands.Push(RenderCommand);
+}
+
+void FRiveRenderTarget::Draw(rive::Artboard* InArtboard,
+                             const FRiveArtboardCSPtr& InArtboardCS)
 {
     FRiveRenderCommand RenderCommand(ERiveRenderCommandType::DrawArtboard);
     RenderCommand.NativeArtboard = InArtboard;
+    RenderCommand.ArtboardCS = InArtboardCS;
     RenderCommands.Push(RenderCommand);
 }
 
@@ -117,7 +140,8 @@ void FRiveRenderTarget::Align(const FBox2f& InBox,
                               ERiveFitType InFit,
                               const FVector2f& InAlignment,
                               float InScaleFactor,
-                              rive::Artboard* InArtboard)
+                              rive::Artboard* InArtboard,
+                              const FRiveArtboardCSPtr& InArtboardCS)
 {
     FRiveRenderCommand RenderCommand(ERiveRenderCommandType::AlignArtboard);
     RenderCommand.FitType = InFit;
@@ -135,19 +159,22 @@ void FRiveRenderTarget::Align(const FBox2f& InBox,
     RenderCommand.Y2 = InBox.Max.Y;
 
     RenderCommand.NativeArtboard = InArtboard;
+    RenderCommand.ArtboardCS = InArtboardCS;
     RenderCommands.Push(RenderCommand);
 }
 
 void FRiveRenderTarget::Align(ERiveFitType InFit,
                               const FVector2f& InAlignment,
                               float InScaleFactor,
-                              rive::Artboard* InArtboard)
+                              rive::Artboard* InArtboard,
+                              const FRiveArtboardCSPtr& InArtboardCS)
 {
     Align(FBox2f(FVector2f{0.f, 0.f}, FVector2f(GetWidth(), GetHeight())),
           InFit,
           InAlignment,
           InScaleFactor,
-          InArtboard);
+          InArtboard,
+          InArtboardCS);
 }
 
 FMatrix FRiveRenderTarget::GetTransformMatrix() const
@@ -198,22 +225,34 @@ void FRiveRenderTarget::RegisterRenderCommand(RiveRenderFunction RenderFunction)
     });
 }
 
+TArray<FRiveRenderCommand> FRiveRenderTarget::TakeRenderCommands()
+{
+    TArray<FRiveRenderCommand> Commands = MoveTemp(RenderCommands);
+    RenderCommands.Reset();
+    return Commands;
+}
+
 std::unique_ptr<rive::RiveRenderer> FRiveRenderTarget::BeginFrame()
 {
     rive::gpu::RenderContext* RenderContextPtr =
         RiveRenderer->GetRenderContext();
-    if (RenderContextPtr == nullptr)
+    const rive::rcp<rive::gpu::RenderTarget> CachedRenderTarget =
+        GetRenderTarget();
+    if (RenderContextPtr == nullptr || CachedRenderTarget == nullptr)
     {
         return nullptr;
     }
 
+    // Sized from the texture we actually draw into rather than from the game
+    // thread texture size, which is already ahead while a resize is in flight
     FColor Color = ClearColor.ToRGBE();
     rive::gpu::RenderContext::FrameDescriptor FrameDescriptor;
-    FrameDescriptor.renderTargetWidth = GetWidth();
-    FrameDescriptor.renderTargetHeight = GetHeight();
+    FrameDescriptor.renderTargetWidth = CachedRenderTarget->width();
+    FrameDescriptor.renderTargetHeight = CachedRenderTarget->height();
     FrameDescriptor.loadAction =
-        bIsCleared ? rive::gpu::LoadAction::clear
-                   : rive::gpu::LoadAction::preserveRenderTarget;
+        bIsCleared && !bPreserveContents
+            ? rive::gpu::LoadAction::clear
+            : rive::gpu::LoadAction::preserveRenderTarget;
     FrameDescriptor.clearColor =
         rive::colorARGB(Color.A, Color.R, Color.G, Color.B);
     FrameDescriptor.wireframe = false;
@@ -268,6 +307,12 @@ void FRiveRenderTarget::Render_Internal(
 {
     FScopeLock Lock(&RiveRenderer->GetThreadDataCS());
 
+    RenderFrame_Internal(RiveRenderCommands);
+}
+
+void FRiveRenderTarget::RenderFrame_Internal(
+    const TArray<FRiveRenderCommand>& RiveRenderCommands)
+{
     // Sometimes Render commands can be empty (perhaps an issue with Lock
     // contention) Checking for empty here will prevent rendered "blank" frames
     if (RiveRenderCommands.IsEmpty())
@@ -289,10 +334,16 @@ void FRiveRenderTarget::Render_Internal(
 #if PLATFORM_ANDROID
     // We need to invert the Y Axis for OpenGL, and this needs to not affect
     // input transforms
-    Renderer->transform(
-        rive::Mat2D::fromScaleAndTranslation(1.f, -1.f, 0.f, GetHeight()));
+    Renderer->transform(rive::Mat2D::fromScaleAndTranslation(
+        1.f,
+        -1.f,
+        0.f,
+        GetRenderTarget()->height()));
 #endif
 
+    // Clips are referenced by the renderer until the end of the frame
+    TArray<rive::rcp<rive::RenderPath>> ClipPaths;
+
     for (const FRiveRenderCommand& RenderCommand : RiveRenderCommands)
     {
         switch (RenderCommand.Type)
@@ -304,19 +355,44 @@ void FRiveRenderTarget::Render_Internal(
                 Renderer->restore();
                 break;
             case ERiveRenderCommandType::DrawArtboard:
+            {
 #if PLATFORM_ANDROID
                 RIVE_DEBUG_VERBOSE("RenderCommand.NativeArtboard->draw()");
 #endif
+                // Only the game thread work on this very artboard can block
+                // us here
+                FScopeLock ArtboardLock(RenderCommand.ArtboardCS.Get());
                 RenderCommand.NativeArtboard->draw(Renderer.get());
                 break;
+            }
             case ERiveRenderCommandType::DrawPath:
                 // TODO: Support DrawPath
                 break;
             case ERiveRenderCommandType::ClipPath:
-                // TODO: Support ClipPath
+            {
+                // Only rectangles for now, from (TX, TY) to (X2, Y2) like
+                // the box of AlignArtboard
+                rive::RawPath ClipRect;
+                ClipRect.addRect({RenderCommand.TX,
+                                  RenderCommand.TY,
+                                  RenderCommand.X2,
+                                  RenderCommand.Y2});
+                rive::rcp<rive::RenderPath> ClipPath =
+                    RiveRenderer->GetRenderContext()->makeRenderPath(
+                        ClipRect,
+                        rive::FillRule::nonZero);
+                Renderer->clipPath(ClipPath.get());
+                ClipPaths.Add(MoveTemp(ClipPath));
                 break;
-            case ERiveRenderCommandType::Transform:
+            }
             case ERiveRenderCommandType::AlignArtboard:
+            {
+                // Alignment reads the artboard bounds
+                FScopeLock ArtboardLock(RenderCommand.ArtboardCS.Get());
+                Renderer->transform(RenderCommand.GetSaved2DTransform());
+                break;
+            }
+            case ERiveRenderCommandType::Transform:
             case ERiveRenderCommandType::Translate:
                 Renderer->transform(RenderCommand.GetSaved2DTransform());
                 break;
@@ -22,6 +22,17 @@ class RiveRenderer;
 class UTexture2DDynamic;
 
 class FRiveRenderer;
+class FRiveRenderTarget;
+
+/**
+ * One render target and the commands recorded for it during a game frame,
+ * as queued by URiveRenderScheduler
+ */
+struct FRiveRenderBatchItem
+{
+    TSharedPtr<FRiveRenderTarget> RenderTarget;
+    TArray<FRiveRenderCommand> RenderCommands;
+};
 
 class FRiveRenderTarget : public IRiveRenderTarget
 {
@@ -67,19 +78,41 @@ public:
                            float TX,
                            float TY) override;
     virtual void Translate(const FVector2f& InVector) override;
-    virtual void Draw(rive::Artboard* InArtboard) override;
+    virtual void ClipRect(const FBox2f& InRect) override;
+    virtual void Draw(rive::Artboard* InArtboard,
+                      const FRiveArtboardCSPtr& InArtboardCS) override;
     virtual void Align(const FBox2f& InBox,
                        ERiveFitType InFit,
                        const FVector2f& InAlignment,
                        float InScaleFactor,
-                       rive::Artboard* InArtboard) override;
+                       rive::Artboard* InArtboard,
+                       const FRiveArtboardCSPtr& InArtboardCS) override;
     virtual void Align(ERiveFitType InFit,
                        const FVector2f& InAlignment,
                        float InScaleFactor,
-                       rive::Artboard* InArtboard) override;
+                       rive::Artboard* InArtboard,
+                       const FRiveArtboardCSPtr& InArtboardCS) override;
     virtual FMatrix GetTransformMatrix() const override;
     virtual void RegisterRenderCommand(
         RiveRenderFunction RenderFunction) override;
+    virtual TArray<FRiveRenderCommand> TakeRenderCommands() override;
+    virtual bool DrawInto_RenderThread(
+        FRHICommandListImmediate& RHICmdList,
+        const FTextureRHIRef& InTexture,
+        const TArray<FRiveRenderCommand>& InRenderCommands) override
+    {
+        return false;
+    }
+
+    /**
+     * Draws the given commands into this target as a single rive frame. The
+     * caller is expected to hold the renderer's ThreadDataCS, artboard locks
+     * are taken per command.
+     */
+    void RenderFrame_Internal(
+        const TArray<FRiveRenderCommand>& RiveRenderCommands);
+
+    UTexture2DDynamic* GetRenderTargetTexture() const { return RenderTarget; }
 
 protected:
     virtual rive::rcp<rive::gpu::RenderTarget> GetRenderTarget() const = 0;
@@ -94,6 +127,8 @@ protected:
 
 protected:
     mutable bool bIsCleared = false;
+    /** Draw on top of the existing content, even once cleared */
+    bool bPreserveContents = false;
     FLinearColor ClearColor = FLinearColor::Transparent;
     FName RiveName;
     TObjectPtr<UTexture2DDynamic> RenderTarget;
@@ -0,0 +1,173 @@
+// Copyright Rive, Inc. All rights reserved.
+
+#include "RiveRenderTargetPool.h"
+
+#include "RenderUtils.h"
+#include "RiveShaderTypes.h"
+#include "Stats/RiveRendererStats.h"
+
+static TAutoConsoleVariable<int32> CVarRiveRenderTargetPool(
+    TEXT("r.rive.rtpool"),
+    1,
+    TEXT("If non 0, the textures Rive renders into are pooled and reused "
+         "between Rive textures, widgets and components of the same size.\n")
+        TEXT("  0: every texture allocates its own\n")
+            TEXT("  1: pooled (default)"),
+    ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarRiveRenderTargetPoolIdleSeconds(
+    TEXT("r.rive.rtpool.idleseconds"),
+    10.f,
+    TEXT("Seconds a free texture stays in the Rive render target pool before "
+         "being released."),
+    ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarRiveRenderTargetPoolMaxMB(
+    TEXT("r.rive.rtpool.maxmb"),
+    256,
+    TEXT("Memory in megabytes above which free textures of the Rive render "
+         "target pool are released, least recently used first. Textures in "
+         "use are never released."),
+    ECVF_Scalability);
+
+FRiveRenderTargetPool::~FRiveRenderTargetPool()
+{
+    // Whoever still uses a texture keeps it alive on its own
+    PooledTextures.Empty();
+    PooledBytes = 0;
+}
+
+FTextureRHIRef FRiveRenderTargetPool::FindFreeOrCreate_RenderThread(
+    FRHICommandList& RHICmdList,
+    const FRHITextureCreateDesc& InDesc)
+{
+    check(IsInRenderingThread());
+
+    if (CVarRiveRenderTargetPool.GetValueOnRenderThread() == 0)
+    {
+        return CREATE_TEXTURE(RHICmdList, InDesc);
+    }
+
+    ++Requests;
+    INC_DWORD_STAT(STAT_RiveRenderTargetPoolRequests);
+
+    const FRHITextureDesc& Desc = InDesc;
+    for (int32 Index = 0; Index < PooledTextures.Num(); ++Index)
+    {
+        FPooledTexture& Pooled = PooledTextures[Index];
+        if (Pooled.Desc == Desc && IsFree(Index))
+        {
+            ++Hits;
+            INC_DWORD_STAT(STAT_RiveRenderTargetPoolHits);
+            Pooled.LastUsedTime = FPlatformTime::Seconds();
+            UpdateStats();
+            return Pooled.Texture;
+        }
+    }
+
+    FTextureRHIRef Texture = CREATE_TEXTURE(RHICmdList, InDesc);
+
+    FPooledTexture& Pooled = PooledTextures.AddDefaulted_GetRef();
+    Pooled.Texture = Texture;
+    Pooled.Desc = Desc;
+    Pooled.SizeInBytes = CalcTextureSize(Desc.Extent.X,
+                                         Desc.Extent.Y,
+                                         Desc.Format,
+                                         Desc.NumMips);
+    Pooled.LastUsedTime = FPlatformTime::Seconds();
+    PooledBytes += Pooled.SizeInBytes;
+
+    // Make room for the new texture among the free ones, our reference keeps
+    // it from being one of them
+    Tick_RenderThread();
+
+    return Texture;
+}
+
+void FRiveRenderTargetPool::Tick_RenderThread()
+{
+    check(IsInRenderingThread());
+
+    if (PooledTextures.IsEmpty())
+    {
+        return;
+    }
+
+    const double Now = FPlatformTime::Seconds();
+    const double IdleSeconds =
+        CVarRiveRenderTargetPool.GetValueOnRenderThread() != 0
+            ? FMath::Max(
+                  CVarRiveRenderTargetPoolIdleSeconds.GetValueOnRenderThread(),
+                  0.f)
+            : 0.0;
+
+    for (int32 Index = PooledTextures.Num() - 1; Index >= 0; --Index)
+    {
+        if (!IsFree(Index))
+        {
+            // Idle time counts from when the last user let go
+            PooledTextures[Index].LastUsedTime = Now;
+        }
+        else if (Now - PooledTextures[Index].LastUsedTime >= IdleSeconds)
+        {
+            Release(Index);
+        }
+    }
+
+    const uint64 MaxBytes =
+        static_cast<uint64>(FMath::Max(
+            CVarRiveRenderTargetPoolMaxMB.GetValueOnRenderThread(),
+            0)) *
+        1024 * 1024;
+    while (PooledBytes > MaxBytes)
+    {
+        int32 OldestIndex = INDEX_NONE;
+        for (int32 Index = 0; Index < PooledTextures.Num(); ++Index)
+        {
+            if (IsFree(Index) &&
+                (OldestIndex == INDEX_NONE ||
+                 PooledTextures[Index].LastUsedTime <
+                     PooledTextures[OldestIndex].LastUsedTime))
+            {
+                OldestIndex = Index;
+            }
+        }
+
+        // Everything left is in use
+        if (OldestIndex == INDEX_NONE)
+        {
+            break;
+        }
+        Release(OldestIndex);
+    }
+
+    UpdateStats();
+}
+
+bool FRiveRenderTargetPool::IsFree(int32 InIndex) const
+{
+    return PooledTextures[InIndex].Texture->GetRefCount() == 1;
+}
+
+void FRiveRenderTargetPool::Release(int32 InIndex)
+{
+    PooledBytes -= PooledTextures[InIndex].SizeInBytes;
+    PooledTextures.RemoveAtSwap(InIndex);
+}
+
+void FRiveRenderTargetPool::UpdateStats() const
+{
+    uint64 FreeBytes = 0;
+    for (int32 Index = 0; Index < PooledTextures.Num(); ++Index)
+    {
+        if (IsFree(Index))
+        {
+            FreeBytes += PooledTextures[Index].SizeInBytes;
+        }
+    }
+
+    SET_MEMORY_STAT(STAT_RiveRenderTargetPoolMemory, PooledBytes);
+    SET_MEMORY_STAT(STAT_RiveRenderTargetPoolFreeMemory, FreeBytes);
+    SET_FLOAT_STAT(STAT_RiveRenderTargetPoolHitRate,
+                   Requests > 0 ? 100.0 * Hits / Requests : 0.0);
+}
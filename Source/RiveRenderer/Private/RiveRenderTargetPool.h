@@ -0,0 +1,74 @@
+// Copyright Rive, Inc. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "RHIResources.h"
+
+class FRHICommandList;
+
+/**
+ * Keeps the textures Rive draws into, and the coverage and clip textures that
+ * go with them, alive once their owner lets go of them, so that the next
+ * request for the same size and format reuses them instead of allocating.
+ * Widgets being rebuilt and list views recycling Rive entries then stop
+ * churning GPU memory.
+ *
+ * A pooled texture is free again as soon as the pool holds its only
+ * reference. Free textures are released once idle for
+ * r.rive.rtpool.idleseconds, and oldest first while the pool is over
+ * r.rive.rtpool.maxmb. Rendering thread only.
+ */
+class FRiveRenderTargetPool
+{
+    /**
+     * Structor(s)
+     */
+
+public:
+    ~FRiveRenderTargetPool();
+
+    /**
+     * Implementation(s)
+     */
+
+public:
+    /**
+     * Returns a free pooled texture created with the same description, or
+     * creates and pools a new one
+     */
+    FTextureRHIRef FindFreeOrCreate_RenderThread(
+        FRHICommandList& RHICmdList,
+        const FRHITextureCreateDesc& InDesc);
+
+    /**
+     * Releases the free textures idle for too long or over the memory cap,
+     * every free texture when pooling is disabled
+     */
+    void Tick_RenderThread();
+
+private:
+    bool IsFree(int32 InIndex) const;
+    void Release(int32 InIndex);
+    void UpdateStats() const;
+
+    /**
+     * Attribute(s)
+     */
+
+private:
+    struct FPooledTexture
+    {
+        FTextureRHIRef Texture;
+        /** Description as requested, RHIs may adjust the one they keep */
+        FRHITextureDesc Desc;
+        uint64 SizeInBytes = 0;
+        double LastUsedTime = 0.0;
+    };
+
+    TArray<FPooledTexture> PooledTextures;
+    uint64 PooledBytes = 0;
+
+    uint64 Requests = 0;
+    uint64 Hits = 0;
+};
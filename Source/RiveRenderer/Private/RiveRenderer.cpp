@@ -5,13 +5,24 @@
 #include "Async/Async.h"
 #include "Engine/TextureRenderTarget2D.h"
 #include "Logs/RiveRendererLog.h"
+#include "Misc/CoreDelegates.h"
+#include "ProfilingDebugging/RealtimeGPUProfiler.h"
 #include "RenderingThread.h"
+#include "RiveRenderScheduler.h"
+#include "RiveRenderTarget.h"
+#include "Stats/RiveRendererStats.h"
 #include "TextureResource.h"
 #include "UObject/Package.h"
 
 // #include "rive/renderer/render_context.hpp"
 
-FRiveRenderer::FRiveRenderer() { RIVE_DEBUG_FUNCTION_INDENT; }
+FRiveRenderer::FRiveRenderer()
+{
+    RIVE_DEBUG_FUNCTION_INDENT;
+
+    OnEndFrameRTHandle = FCoreDelegates::OnEndFrameRT.AddLambda(
+        [this]() { RenderTargetPool.Tick_RenderThread(); });
+}
 
 FRiveRenderer::~FRiveRenderer()
 {
@@ -29,6 +40,9 @@ FRiveRenderer::~FRiveRenderer()
     }
 
     FlushRenderingCommands();
+
+    // Only once the rendering thread is idle, it is the one broadcasting
+    FCoreDelegates::OnEndFrameRT.Remove(OnEndFrameRTHandle);
 }
 
 void FRiveRenderer::Initialize()
@@ -74,6 +88,34 @@ void FRiveRenderer::CallOrRegister_OnInitialized(
     }
 }
 
+void FRiveRenderer::ReleaseTextureTarget_GameThread(const FName& InRiveName)
+{
+    check(IsInGameThread());
+
+    TSharedPtr<FRiveRenderTarget> RenderTarget;
+    {
+        FScopeLock Lock(&ThreadDataCS);
+        RenderTargets.RemoveAndCopyValue(InRiveName, RenderTarget);
+    }
+    if (!RenderTarget)
+    {
+        return;
+    }
+
+    // Render commands it queued reference it raw, the last reference goes
+    // after them
+    ENQUEUE_RENDER_COMMAND(RiveReleaseTextureTarget)
+    ([RenderTarget = MoveTemp(RenderTarget)](FRHICommandListImmediate&) {});
+}
+
+void FRiveRenderer::FlushPendingRenderTargets_GameThread()
+{
+    if (URiveRenderScheduler* Scheduler = URiveRenderScheduler::Get())
+    {
+        Scheduler->FlushPendingRenderTargets();
+    }
+}
+
 rive::gpu::RenderContext* FRiveRenderer::GetRenderContext()
 {
     if (!RenderContext)
@@ -87,8 +129,32 @@ rive::gpu::RenderContext* FRiveRenderer::GetRenderContext()
     return RenderContext.get();
 }
 
+DECLARE_GPU_STAT_NAMED(RenderBatch, TEXT("RiveRenderer::RenderBatch"));
+void FRiveRenderer::RenderBatch_RenderThread(
+    FRHICommandListImmediate& RHICmdList,
+    const TArray<FRiveRenderBatchItem>& InBatch)
+{
+    SCOPE_CYCLE_COUNTER(STAT_RiveRenderBatch);
+    SCOPED_GPU_STAT(RHICmdList, RenderBatch);
+    SCOPED_DRAW_EVENT(RHICmdList, RiveRenderBatch);
+    check(IsInRenderingThread());
+
+    FScopeLock Lock(&ThreadDataCS);
+    for (const FRiveRenderBatchItem& Item : InBatch)
+    {
+        Item.RenderTarget->RenderFrame_Internal(Item.RenderCommands);
+    }
+}
+
 #endif // WITH_RIVE
 
+FTextureRHIRef FRiveRenderer::CreatePooledTexture_RenderThread(
+    FRHICommandList& RHICmdList,
+    const FRHITextureCreateDesc& InDesc)
+{
+    return RenderTargetPool.FindFreeOrCreate_RenderThread(RHICmdList, InDesc);
+}
+
 UTextureRenderTarget2D* FRiveRenderer::CreateDefaultRenderTarget(
     FIntPoint InTargetSize)
 {
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "IRiveRenderer.h"
+#include "RiveRenderTargetPool.h"
 #include "RiveTypes.h"
 
 #include <memory>
@@ -18,6 +19,7 @@ class RenderContext;
 #endif // WITH_RIVE
 
 class FRiveRenderTarget;
+struct FRiveRenderBatchItem;
 
 class FRiveRenderer : public IRiveRenderer
 {
@@ -47,6 +49,9 @@ public:
         return nullptr;
     }
 
+    virtual void ReleaseTextureTarget_GameThread(
+        const FName& InRiveName) override;
+
     virtual UTextureRenderTarget2D* CreateDefaultRenderTarget(
         FIntPoint InTargetSize) override;
 
@@ -58,6 +63,12 @@ public:
     virtual void CallOrRegister_OnInitialized(
         FOnRendererInitialized::FDelegate&& Delegate) override;
 
+    virtual void FlushPendingRenderTargets_GameThread() override;
+
+    virtual FTextureRHIRef CreatePooledTexture_RenderThread(
+        FRHICommandList& RHICmdList,
+        const FRHITextureCreateDesc& InDesc) override;
+
 #if WITH_RIVE
 
     virtual rive::gpu::RenderContext* GetRenderContext() override;
@@ -66,6 +77,23 @@ public:
 
     //~ END : IRiveRenderer Interface
 
+    /**
+     * Implementation(s)
+     */
+
+public:
+#if WITH_RIVE
+
+    /**
+     * Renders every target queued by URiveRenderScheduler this frame, in
+     * order, holding ThreadDataCS once for the whole batch
+     */
+    virtual void RenderBatch_RenderThread(
+        FRHICommandListImmediate& RHICmdList,
+        const TArray<FRiveRenderBatchItem>& InBatch);
+
+#endif // WITH_RIVE
+
     /**
      * Attribute(s)
      */
@@ -79,6 +107,10 @@ protected:
 
     TMap<FName, TSharedPtr<FRiveRenderTarget>> RenderTargets;
 
+    /** Render thread only */
+    FRiveRenderTargetPool RenderTargetPool;
+    FDelegateHandle OnEndFrameRTHandle;
+
 protected:
     mutable FCriticalSection ThreadDataCS;
 
@@ -0,0 +1,12 @@
+// Copyright Rive, Inc. All rights reserved.
+
+#include "RiveRendererStats.h"
+
+DEFINE_STAT(STAT_RiveRenderBatch);
+DEFINE_STAT(STAT_RiveBatchesPerFrame);
+DEFINE_STAT(STAT_RiveTargetsPerFrame);
+DEFINE_STAT(STAT_RiveRenderTargetPoolRequests);
+DEFINE_STAT(STAT_RiveRenderTargetPoolHits);
+DEFINE_STAT(STAT_RiveRenderTargetPoolHitRate);
+DEFINE_STAT(STAT_RiveRenderTargetPoolMemory);
+DEFINE_STAT(STAT_RiveRenderTargetPoolFreeMemory);
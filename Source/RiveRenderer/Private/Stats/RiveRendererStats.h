@@ -0,0 +1,34 @@
+// Copyright Rive, Inc. All rights reserved.
+
+#pragma once
+
+#include "Stats/Stats.h"
+
+DECLARE_STATS_GROUP(TEXT("RiveRenderer"),
+                    STATGROUP_RiveRenderer,
+                    STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Render Batch (RT)"),
+                          STAT_RiveRenderBatch,
+                          STATGROUP_RiveRenderer, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Batches Per Frame"),
+                                  STAT_RiveBatchesPerFrame,
+                                  STATGROUP_RiveRenderer, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Targets Per Frame"),
+                                  STAT_RiveTargetsPerFrame,
+                                  STATGROUP_RiveRenderer, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Render Target Pool Requests"),
+                                  STAT_RiveRenderTargetPoolRequests,
+                                  STATGROUP_RiveRenderer, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Render Target Pool Hits"),
+                                  STAT_RiveRenderTargetPoolHits,
+                                  STATGROUP_RiveRenderer, );
+DECLARE_FLOAT_ACCUMULATOR_STAT_EXTERN(TEXT("Render Target Pool Hit Rate (%)"),
+                                      STAT_RiveRenderTargetPoolHitRate,
+                                      STATGROUP_RiveRenderer, );
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Render Target Pool Memory"),
+                           STAT_RiveRenderTargetPoolMemory,
+                           STATGROUP_RiveRenderer, );
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Render Target Pool Free Memory"),
+                           STAT_RiveRenderTargetPoolFreeMemory,
+                           STATGROUP_RiveRenderer, );
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "RHICommandList.h"
+#include "RiveTypes.h"
 
 #if WITH_RIVE
 
@@ -26,6 +27,8 @@ class rendererRenderContext;
 
 #endif // WITH_RIVE
 
+struct FRiveRenderCommand;
+
 using RiveRenderFunction =
     TUniqueFunction<void(rive::Factory* factory, rive::Renderer* renderer)>;
 class IRiveRenderTarget : public TSharedFromThis<IRiveRenderTarget>
@@ -57,21 +60,42 @@ public:
                            float TX,
                            float TY) = 0;
     virtual void Translate(const FVector2f& InVector) = 0;
-    virtual void Draw(rive::Artboard* InArtboard) = 0;
+    /** Clips what is drawn next to InRect, until the matching Restore */
+    virtual void ClipRect(const FBox2f& InRect) = 0;
+    virtual void Draw(rive::Artboard* InArtboard,
+                      const FRiveArtboardCSPtr& InArtboardCS) = 0;
     virtual void Align(const FBox2f& InBox,
                        ERiveFitType InFit,
                        const FVector2f& InAlignment,
                        float InScaleFactor,
-                       rive::Artboard* InArtboard) = 0;
+                       rive::Artboard* InArtboard,
+                       const FRiveArtboardCSPtr& InArtboardCS) = 0;
     virtual void Align(ERiveFitType InFit,
                        const FVector2f& InAlignment,
                        float InScaleFactor,
-                       rive::Artboard* InArtboard) = 0;
+                       rive::Artboard* InArtboard,
+                       const FRiveArtboardCSPtr& InArtboardCS) = 0;
     virtual void RegisterRenderCommand(RiveRenderFunction RenderFunction) = 0;
     /** Returns the transformation Matrix from the start of the Render Queue up
      * to now */
     virtual FMatrix GetTransformMatrix() const = 0;
 
+    /**
+     * Hands over the commands recorded since the last submit instead of
+     * submitting them, for the caller to draw with DrawInto_RenderThread
+     */
+    virtual TArray<FRiveRenderCommand> TakeRenderCommands() = 0;
+
+    /**
+     * Draws the commands on top of the content of another texture, such as a
+     * window back buffer, instead of into our own texture
+     * @return false if the renderer can't draw into that texture
+     */
+    virtual bool DrawInto_RenderThread(
+        FRHICommandListImmediate& RHICmdList,
+        const FTextureRHIRef& InTexture,
+        const TArray<FRiveRenderCommand>& InRenderCommands) = 0;
+
 #endif // WITH_RIVE
 
     virtual void CacheTextureTarget_RenderThread(
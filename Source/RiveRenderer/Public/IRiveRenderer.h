@@ -4,6 +4,7 @@
 
 #include "IRiveRenderTarget.h"
 
+class UTexture2D;
 class UTexture2DDynamic;
 class UTextureRenderTarget2D;
 
@@ -42,6 +43,13 @@ public:
         const FName& InRiveName,
         UTexture2DDynamic* InRenderTarget) = 0;
 
+    /**
+     * Lets go of the render target created for InRiveName once the rendering
+     * thread is done with what it already submitted, along with the texture
+     * it drew into. Callers must drop their own references to it.
+     */
+    virtual void ReleaseTextureTarget_GameThread(const FName& InRiveName) = 0;
+
     virtual void CreateRenderContext_RenderThread(
         FRHICommandListImmediate& RHICmdList) = 0;
 
@@ -53,9 +61,54 @@ public:
     virtual void CallOrRegister_OnInitialized(
         FOnRendererInitialized::FDelegate&& Delegate) = 0;
 
+    /**
+     * Sends the render targets submitted so far this frame to the rendering
+     * thread, instead of waiting for the end of the world tick
+     */
+    virtual void FlushPendingRenderTargets_GameThread() = 0;
+
+    /**
+     * Returns a texture matching the description from the pool shared by
+     * every Rive render target, creating it if none is free. The texture goes
+     * back to the pool once the last reference to it is released.
+     */
+    virtual FTextureRHIRef CreatePooledTexture_RenderThread(
+        FRHICommandList& RHICmdList,
+        const FRHITextureCreateDesc& InDesc) = 0;
+
 #if WITH_RIVE
 
     virtual rive::gpu::RenderContext* GetRenderContext() = 0;
 
+    /** Whether MakeImage is available, see there */
+    virtual bool CanMakeImage() const { return false; }
+
+    /**
+     * Creates an image from pixels already decoded to BGRA8, so that callers
+     * can decode on their own threads instead of through
+     * RenderContext::decodeImage. Call with GetThreadDataCS held.
+     */
+    virtual rive::rcp<rive::RenderImage> MakeImage(
+        uint32 InWidth,
+        uint32 InHeight,
+        const TArray<uint8>& InPixelsBGRA8)
+    {
+        return nullptr;
+    }
+
+    /**
+     * Creates an image sampling InTexture in place, whichever its format, its
+     * compression and its streamed mips, instead of from a copy of its
+     * pixels. Null where not supported, see CanMakeImage. sRGB textures are
+     * sampled through a linear view, keeping their encoded values like
+     * decoded images. The texture must outlive the image. Call with
+     * GetThreadDataCS held.
+     */
+    virtual rive::rcp<rive::RenderImage> MakeImageFromTexture(
+        UTexture2D* InTexture)
+    {
+        return nullptr;
+    }
+
 #endif // WITH_RIVE
 };
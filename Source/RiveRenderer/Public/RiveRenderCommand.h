@@ -81,6 +81,9 @@ public:
     // UPROPERTY(BlueprintReadWrite)
     rive::Artboard* NativeArtboard = nullptr;
 
+    /** Lock of NativeArtboard, held while the render thread reads it */
+    FRiveArtboardCSPtr ArtboardCS;
+
     UPROPERTY(BlueprintReadWrite, Category = Rive)
     float X;
 
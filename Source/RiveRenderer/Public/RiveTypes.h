@@ -5,6 +5,12 @@
 #include "CoreMinimal.h"
 #include "RiveTypes.generated.h"
 
+/**
+ * Lock owned by a single artboard, shared with every render command that reads
+ * that artboard
+ */
+using FRiveArtboardCSPtr = TSharedPtr<FCriticalSection, ESPMode::ThreadSafe>;
+
 USTRUCT(Blueprintable)
 struct RIVERENDERER_API FRiveStateMachineEvent
 {